@@ -0,0 +1,126 @@
+#include "common/enum.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Looks up values and names across many holders of distinct sizes. Every size instantiates its own
+// search functions, so the lookups spread over as much code as a large program with many enums.
+// Build it with and without TRLC_ENUM_NO_ERASED_CORE and compare the timings and `size` output.
+
+namespace
+{
+constexpr size_t kHolders{64};      ///< The number of distinct holders.
+constexpr size_t kNameLength{8};    ///< The length of every name.
+constexpr size_t kMaxEntries{kHolders + 4};
+constexpr size_t kLookups{1 << 22}; ///< The number of lookups per pass.
+
+struct NamePool
+{
+    char text[kMaxEntries * kNameLength]{};
+};
+
+constexpr NamePool makeNames()
+{
+    NamePool pool{};
+    for (size_t index{0}; index < kMaxEntries; ++index)
+    {
+        char* name{pool.text + index * kNameLength};
+        const char prefix[]{"Entry_"};
+        for (size_t offset{0}; offset < 6; ++offset)
+        {
+            name[offset] = prefix[offset];
+        }
+        name[6] = static_cast<char>('0' + index / 10);
+        name[7] = static_cast<char>('0' + index % 10);
+    }
+    return pool;
+}
+
+constexpr NamePool kNames{makeNames()};
+
+constexpr std::string_view nameAt(size_t index)
+{
+    return std::string_view{kNames.text + index * kNameLength, kNameLength};
+}
+
+template<size_t K>
+struct Table
+{
+    static constexpr size_t kSize{K + 4};
+
+    static constexpr std::array<trlc::DefaultEnum, kSize> makeEntries()
+    {
+        std::array<trlc::DefaultEnum, kSize> entries{};
+        for (size_t index{0}; index < kSize; ++index)
+        {
+            entries[index] = trlc::DefaultEnum{index * 3 + 1, nameAt(index)};
+        }
+        return entries;
+    }
+
+    static constexpr std::array<trlc::DefaultEnum, kSize> kEntries{makeEntries()};
+    static constexpr trlc::DefaultEnumHolder<kSize> kHolder{kEntries};
+
+    static uint32_t lookup(uint32_t value, std::string_view name)
+    {
+        return static_cast<uint32_t>(kHolder.fromValue(value).name.size() + kHolder.fromString(name).value);
+    }
+};
+
+using Lookup = uint32_t (*)(uint32_t, std::string_view);
+
+template<size_t... K>
+constexpr std::array<Lookup, kHolders> makeLookups(std::index_sequence<K...>)
+{
+    return {&Table<K>::lookup...};
+}
+
+constexpr std::array<Lookup, kHolders> kLookupTable{makeLookups(std::make_index_sequence<kHolders>{})};
+
+struct Query
+{
+    uint32_t holder;
+    uint32_t value;
+    std::string_view name;
+};
+} // namespace
+
+int main()
+{
+    std::mt19937 random{42};
+    std::vector<Query> queries(kLookups);
+    for (auto& query : queries)
+    {
+        query.holder = static_cast<uint32_t>(random() % kHolders);
+        const uint32_t entry{static_cast<uint32_t>(random() % (query.holder + 4))};
+        query.value = entry * 3 + 1;
+        query.name = nameAt(entry);
+    }
+
+    uint32_t checksum{0};
+    double best{0};
+    for (int pass{0}; pass < 5; ++pass)
+    {
+        const auto start{std::chrono::steady_clock::now()};
+        for (const auto& query : queries)
+        {
+            checksum += kLookupTable[query.holder](query.value, query.name);
+        }
+        const double nanos{std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kLookups};
+        best = pass == 0 ? nanos : std::min(best, nanos);
+    }
+
+#if defined(TRLC_ENUM_ERASED_CORE)
+    const char* variant{"erased core"};
+#else
+    const char* variant{"templated"};
+#endif
+    std::printf("%s: %zu holders, %.2f ns per value+name lookup (checksum %u)\n", variant, kHolders, best, checksum);
+    return 0;
+}
\ No newline at end of file
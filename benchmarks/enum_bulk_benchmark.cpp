@@ -0,0 +1,82 @@
+#include "common/enum/bulk.hpp"
+#include "common/enum/runtime.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Measures the throughput of `valuesToNames` and `namesToValues` over a `RuntimeEnumHolder` for
+// 1, 2, 4, ... threads up to the hardware concurrency (or the first argument), to show how the
+// bulk conversions scale, then two callers converting at once, which share the pool threads.
+
+namespace
+{
+constexpr size_t kNames{1000};     ///< The number of entries of the holder.
+constexpr size_t kRows{1 << 22};  ///< The number of rows per conversion.
+
+template<class Body>
+double bestRowsPerSecond(Body body)
+{
+    double best{0};
+    for (int pass{0}; pass < 5; ++pass)
+    {
+        const auto start{std::chrono::steady_clock::now()};
+        body();
+        const double seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+        best = std::max(best, static_cast<double>(kRows) / seconds);
+    }
+    return best;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::vector<trlc::RuntimeEnumHolder<uint32_t>::Definition> definitions;
+    for (uint32_t index{0}; index < kNames; ++index)
+    {
+        definitions.emplace_back(index, "ERROR_CATEGORY_" + std::to_string(index * 7919));
+    }
+    const trlc::RuntimeEnumHolder<uint32_t> holder{definitions};
+    holder.warmUp();
+
+    std::mt19937 random{42};
+    std::vector<uint32_t> values(kRows);
+    for (auto& value : values)
+    {
+        value = static_cast<uint32_t>(random() % kNames);
+    }
+    std::vector<std::string_view> names(kRows);
+    std::vector<uint32_t> parsed(kRows);
+
+    const size_t cores{argc > 1 ? std::max<size_t>(std::stoul(argv[1]), 1) : std::max(std::thread::hardware_concurrency(), 1u)};
+    std::printf("%zu rows, %zu names, %zu threads at most\n", kRows, kNames, cores);
+    std::printf("threads  values->names (Mrows/s)  names->values (Mrows/s)\n");
+    std::vector<size_t> threadCounts;
+    for (size_t threads{1}; threads < cores; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(cores);
+    for (const size_t threads : threadCounts)
+    {
+        const double toNames{bestRowsPerSecond([&]() { trlc::valuesToNames(holder, values.data(), kRows, names.data(), threads); })};
+        const double toValues{bestRowsPerSecond([&]() { trlc::namesToValues(holder, names.data(), kRows, parsed.data(), threads); })};
+        std::printf("%7zu  %23.1f  %23.1f\n", threads, toNames / 1e6, toValues / 1e6);
+    }
+
+    // Each caller converts half the rows; the total is comparable to the table above.
+    std::vector<std::string_view> otherNames(kRows / 2);
+    const double concurrent{bestRowsPerSecond([&]() {
+        std::thread other{[&]() { trlc::valuesToNames(holder, values.data() + kRows / 2, kRows / 2, otherNames.data(), cores); }};
+        trlc::valuesToNames(holder, values.data(), kRows / 2, names.data(), cores);
+        other.join();
+    })};
+    std::printf("2 callers x %zu threads, values->names: %.1f Mrows/s\n", cores, concurrent / 1e6);
+    return 0;
+}
\ No newline at end of file
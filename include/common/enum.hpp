@@ -1,12 +1,16 @@
+#pragma once
 #include "enum/detail.hpp"
+#include "enum/packed.hpp"
+#include "enum/unicode.hpp"
+#include "enum/wide.hpp"
 
 namespace trlc
 {
 
-template<typename T>
+template<typename T, typename CharT>
 struct Enum;
 
-template<typename T, size_t N, class EnumSearchPolicy, class StringSearchPolicy, class UnknownPolicy>
+template<typename T, size_t N, class EnumSearchPolicy, class StringSearchPolicy, class UnknownPolicy, typename CharT>
 struct EnumHolder;
 
 using DefaultEnum = trlc::Enum<uint64_t>;
@@ -0,0 +1,103 @@
+#pragma once
+#include "detail.hpp"
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace trlc
+{
+
+/**
+ * @brief An `EnumHolder` that also carries attribute columns parallel to its entries.
+ *
+ * Each column is a `std::array` with one attribute per entry, in entry order, e.g. a description,
+ * a severity and a retry flag. Columns are usually `constexpr` tables like the entries, so they
+ * cost nothing at startup, and reading an attribute once the entry's slot is known is a single
+ * array load.
+ *
+ * @tparam Holder The `EnumHolder` type of the entries.
+ * @tparam Columns The attribute type of each column.
+ */
+template<class Holder, typename... Columns>
+class AttributedEnumHolder : public Holder
+{
+    using Entries = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<const Holder&>().m_entries)>>;
+    using T = decltype(std::declval<typename Entries::value_type>().value);
+    using CharT = typename Holder::char_type;
+    static constexpr size_t N{Holder::size()};
+
+public:
+    /// The attribute type of column `I`.
+    template<size_t I>
+    using Column = std::tuple_element_t<I, std::tuple<Columns...>>;
+
+    /**
+     * @brief Creates a holder over the entries and their attribute columns.
+     *
+     * @param entries The array of Enum entries, which must outlive the holder.
+     * @param columns One array per column with the attributes of the entries, in entry order, which must outlive the holder.
+     */
+    constexpr AttributedEnumHolder(const Entries& entries, const std::array<Columns, N>&... columns)
+        : Holder(entries),
+          m_columns(columns...)
+    {
+    }
+
+    /**
+     * @brief Returns a whole column.
+     *
+     * @tparam I The column.
+     */
+    template<size_t I>
+    constexpr const std::array<Column<I>, N>& column() const
+    {
+        return std::get<I>(m_columns);
+    }
+
+    /**
+     * @brief Returns the attribute of an entry.
+     *
+     * @tparam I The column.
+     * @param index The slot of the entry, from `indexFromValue` or `indexFromString`.
+     * @return The attribute, or a value-initialized attribute if the slot is past the entries.
+     */
+    template<size_t I>
+    constexpr Column<I> attribute(size_t index) const
+    {
+        return index < N ? std::get<I>(m_columns)[index] : Column<I>{};
+    }
+
+    /**
+     * @brief Returns the attribute of the entry holding a value.
+     *
+     * @tparam I The column.
+     * @param value The enum value to search for.
+     * @return The attribute, or a value-initialized attribute if no entry holds the value.
+     */
+    template<size_t I>
+    constexpr Column<I> attributeFromValue(T value) const
+    {
+        return attribute<I>(Holder::indexFromValue(value));
+    }
+
+    /**
+     * @brief Returns the attribute of the entry with a name.
+     *
+     * @tparam I The column.
+     * @param name The name to search for.
+     * @return The attribute, or a value-initialized attribute if no entry has the name.
+     */
+    template<size_t I>
+    constexpr Column<I> attributeFromString(std::basic_string_view<CharT> name) const
+    {
+        return attribute<I>(Holder::indexFromString(name));
+    }
+
+private:
+    std::tuple<const std::array<Columns, N>&...> m_columns; ///< The attribute columns.
+};
+
+} // namespace trlc
\ No newline at end of file
@@ -0,0 +1,255 @@
+#pragma once
+#include "../define.hpp"
+#include "detail.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace trlc
+{
+
+namespace detail
+{
+/// Bytes of input and output processed per chunk, sized to stay resident in a core's L2 cache.
+inline constexpr size_t kBulkChunkBytes{64 * 1024};
+
+/**
+ * @brief Threads kept alive across bulk conversions, so a call does not pay for thread creation.
+ *
+ * Threads are started on demand, up to the most helpers any call asked for, and joined at exit.
+ * Calls from several threads share them: each call queues its job, idle pool threads take the
+ * oldest job that still wants helpers, and the calling thread works on its own job meanwhile. A
+ * call made while every pool thread is busy, e.g. from inside a conversion or from a second
+ * service converting at the same time, thus starts alone and gains helpers as earlier jobs finish.
+ */
+class BulkThreadPool
+{
+public:
+    UNCOPYABLE(BulkThreadPool)
+
+    /**
+     * @brief Returns the process-wide pool.
+     */
+    static BulkThreadPool& instance()
+    {
+        static BulkThreadPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Runs `work` on up to `helpers` pool threads and on the calling thread, and waits for all of them.
+     *
+     * `work` must share its items between the threads running it, e.g. through a cursor, since
+     * helpers that are busy with other jobs may never join this one.
+     *
+     * @param helpers The number of pool threads to run `work` on.
+     * @param work The job; it must not throw.
+     */
+    void run(size_t helpers, const std::function<void()>& work)
+    {
+        Job job{&work};
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            // Start missing threads; if the system refuses, run with those there are.
+            try
+            {
+                while (m_threads.size() < helpers)
+                {
+                    m_threads.emplace_back([this]() { serve(); });
+                }
+            }
+            catch (const std::system_error&)
+            {
+            }
+            job.wanted = std::min(helpers, m_threads.size());
+            if (job.wanted > 0)
+            {
+                m_queue.push_back(&job);
+            }
+        }
+        m_wake.notify_all();
+
+        work();
+
+        // The work is done once the calling thread runs out of it; stop further helpers from joining.
+        std::unique_lock<std::mutex> lock{m_mutex};
+        const auto queued{std::find(m_queue.begin(), m_queue.end(), &job)};
+        if (queued != m_queue.end())
+        {
+            m_queue.erase(queued);
+        }
+        m_finished.wait(lock, [&job]() { return job.finished == job.claimed; });
+    }
+
+private:
+    /**
+     * @brief A call waiting for helpers, owned by the calling thread.
+     */
+    struct Job
+    {
+        const std::function<void()>* work{nullptr}; ///< The work to run.
+        size_t wanted{0};                           ///< Helpers the call asked for.
+        size_t claimed{0};                          ///< Helpers that took the job.
+        size_t finished{0};                         ///< Helpers that finished the job.
+    };
+
+    BulkThreadPool() = default;
+
+    ~BulkThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    void serve()
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        while (true)
+        {
+            m_wake.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_stop)
+            {
+                return;
+            }
+            Job& job{*m_queue.front()};
+            if (++job.claimed == job.wanted)
+            {
+                m_queue.pop_front();
+            }
+            lock.unlock();
+            (*job.work)();
+            lock.lock();
+            ++job.finished;
+            m_finished.notify_all();
+        }
+    }
+
+    std::mutex m_mutex;                 ///< Guards the queue and the jobs in it.
+    std::condition_variable m_wake;     ///< Signals a queued job or the end of the pool.
+    std::condition_variable m_finished; ///< Signals that a helper finished a job.
+    std::vector<std::thread> m_threads; ///< The pool threads.
+    std::deque<Job*> m_queue;           ///< Jobs that still want helpers, oldest first.
+    bool m_stop{false};                 ///< Asks the pool threads to exit.
+};
+
+/**
+ * @brief Runs a conversion over `count` rows split into cache-sized chunks on several threads.
+ *
+ * Workers of the `BulkThreadPool` claim chunks from a shared cursor, so threads that finish early
+ * keep taking work from the remaining range instead of idling. The calling thread takes part in
+ * the work. If `convert` throws, the remaining chunks are skipped and the first exception is
+ * rethrown on the calling thread once every worker has stopped.
+ *
+ * @param count The number of rows.
+ * @param rowBytes The bytes read and written per row.
+ * @param threads The number of threads to use, `0` for the hardware concurrency.
+ * @param convert Called as `convert(first, last)` for each chunk.
+ */
+template<class Convert>
+void parallelChunks(size_t count, size_t rowBytes, size_t threads, const Convert& convert)
+{
+    const size_t chunk{std::max<size_t>(kBulkChunkBytes / std::max<size_t>(rowBytes, 1), 1)};
+    const size_t chunks{(count + chunk - 1) / chunk};
+    if (threads == 0)
+    {
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    threads = std::min(threads, chunks);
+    if (threads <= 1)
+    {
+        convert(size_t{0}, count);
+        return;
+    }
+
+    std::atomic<size_t> cursor{0};
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    const std::function<void()> work{[&]() {
+        try
+        {
+            for (size_t index{cursor.fetch_add(1, std::memory_order_relaxed)}; index < chunks; index = cursor.fetch_add(1, std::memory_order_relaxed))
+            {
+                convert(index * chunk, std::min(count, (index + 1) * chunk));
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock{errorMutex};
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+            cursor.store(chunks, std::memory_order_relaxed);
+        }
+    }};
+
+    BulkThreadPool::instance().run(threads - 1, work);
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+} // namespace detail
+
+/**
+ * @brief Converts a column of values to their names in parallel.
+ *
+ * Unknown values are resolved by the holder's unknown policy.
+ *
+ * @param holder The holder to look values up in (`EnumHolder`, `RuntimeEnumHolder`, ...).
+ * @param values The values to convert.
+ * @param count The number of values.
+ * @param names Receives `count` names, as string views of the holder's character type.
+ * @param threads The number of threads to use, `0` for the hardware concurrency.
+ */
+template<class Holder, typename T, typename Name>
+void valuesToNames(const Holder& holder, const T* values, size_t count, Name* names, size_t threads = 0)
+{
+    detail::parallelChunks(count, sizeof(T) + sizeof(Name), threads, [&](size_t first, size_t last) {
+        for (size_t row{first}; row < last; ++row)
+        {
+            names[row] = holder.fromValue(values[row]).name;
+        }
+    });
+}
+
+/**
+ * @brief Converts a column of names to their values in parallel.
+ *
+ * Unknown names are resolved by the holder's unknown policy.
+ *
+ * @param holder The holder to look names up in (`EnumHolder`, `RuntimeEnumHolder`, ...).
+ * @param names The names to convert.
+ * @param count The number of names.
+ * @param values Receives `count` values.
+ * @param threads The number of threads to use, `0` for the hardware concurrency.
+ */
+template<class Holder, typename Name, typename T>
+void namesToValues(const Holder& holder, const Name* names, size_t count, T* values, size_t threads = 0)
+{
+    detail::parallelChunks(count, sizeof(Name) + sizeof(T), threads, [&](size_t first, size_t last) {
+        for (size_t row{first}; row < last; ++row)
+        {
+            values[row] = holder.fromString(names[row]).value;
+        }
+    });
+}
+
+} // namespace trlc
\ No newline at end of file
@@ -0,0 +1,175 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#if !defined(TRLC_ENUM_NO_ERASED_CORE)
+/// Lookups of `LinearSearchPolicy`, `SortedSearchPolicy` and `CaseSensitiveStringSearchPolicy` run
+/// on the shared kernels below at runtime. Define `TRLC_ENUM_NO_ERASED_CORE` to inline a loop per
+/// holder instead.
+#define TRLC_ENUM_ERASED_CORE 1
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TRLC_ENUM_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define TRLC_ENUM_NOINLINE __declspec(noinline)
+#else
+#define TRLC_ENUM_NOINLINE
+#endif
+
+namespace trlc
+{
+namespace detail
+{
+/**
+ * @brief Type-erased view of an array of Enum entries.
+ *
+ * The lookup kernels below take this descriptor instead of `std::array<Enum<T>, N>`, so a program
+ * holds one copy of each loop however many `EnumHolder<T, N, ...>` it instantiates; the policies
+ * only build the descriptor and forward to them.
+ */
+struct EntryTable
+{
+    const unsigned char* base{nullptr}; ///< Address of the first entry.
+    size_t count{0};                    ///< The number of entries.
+    size_t stride{0};                   ///< The distance between two entries, in bytes.
+};
+
+/**
+ * @brief Reads an integral value of `U` bytes at the start of an entry, widened to 64 bits.
+ *
+ * @param entry The entry.
+ * @return The value, sign-extended when `Signed`.
+ */
+template<typename U, bool Signed>
+inline uint64_t loadValue(const unsigned char* entry)
+{
+    U value;
+    std::memcpy(&value, entry, sizeof(value));
+    if constexpr (Signed)
+    {
+        return static_cast<uint64_t>(static_cast<int64_t>(static_cast<std::make_signed_t<U>>(value)));
+    }
+    else
+    {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+template<typename U, bool Signed>
+inline size_t findValueAs(const EntryTable& table, uint64_t key)
+{
+    for (size_t index{0}; index < table.count; ++index)
+    {
+        if (loadValue<U, Signed>(table.base + index * table.stride) == key)
+        {
+            return index;
+        }
+    }
+    return table.count;
+}
+
+template<typename U, bool Signed>
+inline size_t findSortedValueAs(const EntryTable& table, uint64_t key)
+{
+    // Flipping the sign bit orders signed values correctly as unsigned integers.
+    constexpr uint64_t kBias{Signed ? uint64_t{1} << 63 : 0};
+    size_t left{0};
+    size_t right{table.count};
+    while (left < right)
+    {
+        const size_t mid{left + (right - left) / 2};
+        const uint64_t value{loadValue<U, Signed>(table.base + mid * table.stride)};
+        if (value == key)
+        {
+            return mid;
+        }
+        if ((value ^ kBias) < (key ^ kBias))
+        {
+            left = mid + 1;
+        }
+        else
+        {
+            right = mid;
+        }
+    }
+    return table.count;
+}
+
+/**
+ * @brief Finds the first entry holding a value.
+ *
+ * @param table The entries.
+ * @param key The value, widened to 64 bits and sign-extended when signed.
+ * @param size The size of the value: 1, 2, 4 or 8 bytes.
+ * @param isSigned Whether the value is signed.
+ * @return The index of the entry, or `table.count` if no entry holds the value.
+ */
+TRLC_ENUM_NOINLINE inline size_t findValue(const EntryTable& table, uint64_t key, size_t size, bool isSigned)
+{
+    switch (size)
+    {
+    case 1:
+        return isSigned ? findValueAs<uint8_t, true>(table, key) : findValueAs<uint8_t, false>(table, key);
+    case 2:
+        return isSigned ? findValueAs<uint16_t, true>(table, key) : findValueAs<uint16_t, false>(table, key);
+    case 4:
+        return isSigned ? findValueAs<uint32_t, true>(table, key) : findValueAs<uint32_t, false>(table, key);
+    default:
+        return findValueAs<uint64_t, false>(table, key);
+    }
+}
+
+/**
+ * @brief Binary-searches a value in entries sorted by value.
+ *
+ * @param table The entries.
+ * @param key The value, widened to 64 bits and sign-extended when signed.
+ * @param size The size of the value: 1, 2, 4 or 8 bytes.
+ * @param isSigned Whether the value is signed.
+ * @return The index of the entry, or `table.count` if no entry holds the value.
+ */
+TRLC_ENUM_NOINLINE inline size_t findSortedValue(const EntryTable& table, uint64_t key, size_t size, bool isSigned)
+{
+    switch (size)
+    {
+    case 1:
+        return isSigned ? findSortedValueAs<uint8_t, true>(table, key) : findSortedValueAs<uint8_t, false>(table, key);
+    case 2:
+        return isSigned ? findSortedValueAs<uint16_t, true>(table, key) : findSortedValueAs<uint16_t, false>(table, key);
+    case 4:
+        return isSigned ? findSortedValueAs<uint32_t, true>(table, key) : findSortedValueAs<uint32_t, false>(table, key);
+    default:
+        return isSigned ? findSortedValueAs<uint64_t, true>(table, key) : findSortedValueAs<uint64_t, false>(table, key);
+    }
+}
+
+/**
+ * @brief Finds the first entry whose `char` name equals a name.
+ *
+ * @param table The entries.
+ * @param nameOffset The offset of the `std::string_view` name inside an entry.
+ * @param name The name to search for.
+ * @return The index of the entry, or `table.count` if no entry has the name.
+ */
+TRLC_ENUM_NOINLINE inline size_t findName(const EntryTable& table, size_t nameOffset, std::string_view name)
+{
+    for (size_t index{0}; index < table.count; ++index)
+    {
+        std::string_view entryName;
+        std::memcpy(static_cast<void*>(&entryName), table.base + index * table.stride + nameOffset, sizeof(entryName));
+        // Shared storage accepts pooled names at once; otherwise the last character rejects most
+        // candidates of the same length before the full compare.
+        if (entryName.size() == name.size() &&
+            (name.empty() || entryName.data() == name.data() || (entryName.back() == name.back() && std::memcmp(entryName.data(), name.data(), name.size()) == 0)))
+        {
+            return index;
+        }
+    }
+    return table.count;
+}
+} // namespace detail
+} // namespace trlc
\ No newline at end of file
@@ -1,21 +1,148 @@
+#pragma once
+#include "core.hpp"
+#include "simd.hpp"
+#include "trace.hpp"
+
 #include <algorithm>
 #include <array>
-#include <iostream>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
+#include <type_traits>
+
+/**
+ * @brief Requires a namespace-scope table or holder to be initialized at compile time.
+ *
+ * Enum tables and `EnumHolder` (including the policy indices) are literal types with constexpr
+ * constructors, so they can always be constant-initialized. Marking a non-constexpr declaration
+ * with this macro turns any initializer that would run at startup, such as a name coming from a
+ * non-constexpr function, into a compile error. Expands to `constinit` in C++20, to the matching
+ * extension of GCC and Clang before that, and to nothing elsewhere.
+ *
+ * Example: `TRLC_CONSTINIT_ENUM const trlc::DefaultEnumHolder<3> kHolder{kEntries};`
+ */
+#if defined(__cpp_constinit)
+#define TRLC_CONSTINIT_ENUM constinit
+#elif defined(__clang__)
+#define TRLC_CONSTINIT_ENUM [[clang::require_constant_initialization]]
+#elif defined(__GNUC__) && __GNUC__ >= 10
+#define TRLC_CONSTINIT_ENUM __constinit
+#else
+#define TRLC_CONSTINIT_ENUM
+#endif
 
 namespace trlc
 {
 
+namespace detail
+{
+/**
+ * @brief Identity alias used to keep a function parameter out of template argument deduction.
+ */
+template<typename T>
+struct TypeIdentity
+{
+    using type = T;
+};
+
+template<typename T>
+using TypeIdentityT = typename TypeIdentity<T>::type;
+
+/**
+ * @brief Dependent `false`, for static assertions that fire only when a template is instantiated.
+ */
+template<typename T>
+inline constexpr bool kAlwaysFalse{false};
+
+/**
+ * @brief Compares two names, accepting names that share storage without reading them.
+ *
+ * Names interned by `NamePool` are equal exactly when they share storage, so comparing names taken
+ * from pooled tables, even of different holders, is a size and pointer compare.
+ */
+template<typename CharT>
+constexpr bool sameName(std::basic_string_view<CharT> lhs, std::basic_string_view<CharT> rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    // Addresses of distinct string literals cannot be compared during constant evaluation.
+    if (!isConstantEvaluated() && lhs.data() == rhs.data())
+    {
+        return true;
+    }
+    return lhs == rhs;
+}
+} // namespace detail
+
+#if defined(TRLC_ENUM_NAMELESS)
+/**
+ * @brief Represents an enumeration value whose name was stripped by `TRLC_ENUM_NAMELESS`.
+ *
+ * Tables keep their `{value, "Name"}` initializers, but the names are discarded at compile time,
+ * so entries are as small as `T` and the strings never reach the binary. Accessing `name` or
+ * calling `fromString` is a compile error. The macro must be set identically in every translation
+ * unit of a program.
+ *
+ * @tparam T The type of the enum value.
+ * @tparam CharT The character type the names would have.
+ */
+template<typename T, typename CharT = char>
+struct Enum
+{
+    using char_type = CharT; ///< The character type of the discarded name.
+
+    T value{}; ///< The enum value.
+
+    constexpr Enum() = default;
+
+    /**
+     * @brief Creates an entry from a value, discarding its name.
+     *
+     * @param enumValue The enum value.
+     */
+    constexpr Enum(T enumValue, [[maybe_unused]] std::basic_string_view<CharT> enumName = {})
+        : value(enumValue)
+    {
+    }
+
+    /**
+     * @brief Converts the Enum to its underlying value type.
+     *
+     * @return The underlying enum value.
+     */
+    constexpr operator T() const
+    {
+        return value;
+    }
+
+    /**
+     * @brief Compare two enums using the == operator.
+     *
+     * @return `true` if both values are equal, otherwise, return `false`
+     */
+    constexpr bool operator==(const Enum<T, CharT>& other)
+    {
+        return value == other.value;
+    }
+};
+#else
+
 /**
  * @brief Represents an enumeration with a value and a name.
  *
  * @tparam T The type of the enum value.
+ * @tparam CharT The character type of the name (`char`, `char8_t`, `char16_t`, `char32_t` or `wchar_t`).
  */
-template<typename T>
+template<typename T, typename CharT = char>
 struct Enum
 {
-    T value{};               ///< The enum value.
-    std::string_view name{}; ///< The name associated with the enum value.
+    using char_type = CharT; ///< The character type of the name.
+
+    T value{};                            ///< The enum value.
+    std::basic_string_view<CharT> name{}; ///< The name associated with the enum value.
 
     /**
      * @brief Converts the Enum to its underlying value type.
@@ -32,15 +159,16 @@ struct Enum
      *
      * @return `true` if both the value and name are equal, otherwise, return `false`
      */
-    constexpr bool operator==(const Enum<T>& other)
+    constexpr bool operator==(const Enum<T, CharT>& other)
     {
-        if (value == other.value && name == other.name)
+        if (value == other.value && detail::sameName(name, other.name))
         {
             return true;
         }
         return false;
     }
 };
+#endif
 
 namespace
 {
@@ -48,40 +176,282 @@ namespace
  * @brief Returns a default unknown enum value.
  *
  * @tparam T The type of the enum value.
+ * @tparam CharT The character type of the name.
  * @return An Enum of type T with default values.
  */
-template<typename T>
-constexpr Enum<T> default_unknown_enum()
+template<typename T, typename CharT = char>
+constexpr Enum<T, CharT> default_unknown_enum()
 {
-    return Enum<T>{};
+    return Enum<T, CharT>{};
 }
 } // namespace
 
+namespace detail
+{
+/**
+ * @brief Returns the slot of the first entry equal to a search result.
+ *
+ * @param result The Enum entry returned by a search.
+ * @param entries The array of Enum entries.
+ * @return The slot of the entry, or `N` if it is not in the array.
+ */
+template<typename T, size_t N, typename CharT>
+constexpr size_t indexOf(Enum<T, CharT> result, const std::array<Enum<T, CharT>, N>& entries)
+{
+    for (size_t index{0}; index < N; ++index)
+    {
+        if (result == entries[index])
+        {
+            return index;
+        }
+    }
+    return N;
+}
+
+template<class Policy, typename T, size_t N, typename CharT, typename Key, typename = void>
+inline constexpr bool kHasStaticFind{false};
+
+template<class Policy, typename T, size_t N, typename CharT, typename Key>
+inline constexpr bool kHasStaticFind<Policy, T, N, CharT, Key,
+                                     std::void_t<decltype(Policy::template find<T, N, CharT>(std::declval<Key>(), std::declval<const std::array<Enum<T, CharT>, N>&>()))>>{true};
+
+template<class Index, typename T, size_t N, typename CharT, typename Key, typename = void>
+inline constexpr bool kHasIndexFind{false};
+
+template<class Index, typename T, size_t N, typename CharT, typename Key>
+inline constexpr bool kHasIndexFind<Index, T, N, CharT, Key, std::void_t<decltype(std::declval<const Index&>().find(std::declval<Key>(), std::declval<const std::array<Enum<T, CharT>, N>&>()))>>{true};
+
+/**
+ * @brief Per-holder state of a search policy.
+ *
+ * Stateless policies are called through their static `search`. A policy that precomputes data from
+ * the entries (folded keys, packed lanes, ...) declares a nested `Index<T, N>` class template,
+ * constructible from the entries and providing a const `search`; the holder builds it once, at
+ * compile time when the holder is `constexpr`.
+ *
+ * Policies may also provide `find`, returning the slot of the entry instead of a copy of it;
+ * without it `find` locates the result of `search` in the entries.
+ *
+ * @tparam Policy The search policy.
+ * @tparam T The type of the enum value.
+ * @tparam N The number of enum entries.
+ * @tparam CharT The character type of the names.
+ */
+template<class Policy, typename T, size_t N, typename CharT, typename = void>
+struct PolicyIndex
+{
+    constexpr explicit PolicyIndex([[maybe_unused]] const std::array<Enum<T, CharT>, N>& entries)
+    {
+    }
+
+    template<typename Key>
+    constexpr Enum<T, CharT> search(Key key, const std::array<Enum<T, CharT>, N>& entries) const
+    {
+        return Policy::template search<T, N>(key, entries);
+    }
+
+    template<typename Key>
+    constexpr size_t find(Key key, const std::array<Enum<T, CharT>, N>& entries) const
+    {
+        if constexpr (kHasStaticFind<Policy, T, N, CharT, Key>)
+        {
+            return Policy::template find<T, N, CharT>(key, entries);
+        }
+        else
+        {
+            Enum<T, CharT> result{search(key, entries)};
+            return result == default_unknown_enum<T, CharT>() ? N : indexOf(result, entries);
+        }
+    }
+};
+
+template<class Policy, typename T, size_t N, typename CharT>
+struct PolicyIndex<Policy, T, N, CharT, std::void_t<typename Policy::template Index<T, N, CharT>>> : Policy::template Index<T, N, CharT>
+{
+    using Base = typename Policy::template Index<T, N, CharT>;
+
+    constexpr explicit PolicyIndex(const std::array<Enum<T, CharT>, N>& entries)
+        : Base(entries)
+    {
+    }
+
+    template<typename Key>
+    constexpr size_t find(Key key, const std::array<Enum<T, CharT>, N>& entries) const
+    {
+        if constexpr (kHasIndexFind<Base, T, N, CharT, Key>)
+        {
+            return Base::find(key, entries);
+        }
+        else
+        {
+            Enum<T, CharT> result{Base::search(key, entries)};
+            return result == default_unknown_enum<T, CharT>() ? N : indexOf(result, entries);
+        }
+    }
+};
+
+/**
+ * @brief Character type of the entries of a holder, `char` when they are not Enum entries.
+ */
+template<class Entries, typename = void>
+struct EntriesChar
+{
+    using type = char;
+};
+
+template<class Entries>
+struct EntriesChar<Entries, std::void_t<typename Entries::value_type::char_type>>
+{
+    using type = typename Entries::value_type::char_type;
+};
+
+/**
+ * @brief Maps an integral or enum value to an unsigned key with the same ordering.
+ *
+ * @param value The value to map.
+ * @return The key, with the sign bit flipped for signed types.
+ */
+template<typename T>
+constexpr uint64_t orderedKey(T value)
+{
+    static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "Ordered keys require integral or enum values");
+    using Underlying = typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::common_type<T>>::type;
+    const auto raw{static_cast<Underlying>(value)};
+    if constexpr (std::is_signed_v<Underlying>)
+    {
+        return static_cast<uint64_t>(static_cast<int64_t>(raw)) ^ (uint64_t{1} << 63);
+    }
+    else
+    {
+        return static_cast<uint64_t>(raw);
+    }
+}
+
+/**
+ * @brief Whether lookups by value of a holder can run on the type-erased core.
+ *
+ * Holds for integral and enum values of 1, 2, 4 or 8 bytes stored at the start of the entries.
+ */
+template<typename T, typename CharT>
+inline constexpr bool kErasableValue{(std::is_integral_v<T> || std::is_enum_v<T>) && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8) &&
+                                     std::is_standard_layout_v<Enum<T, CharT>>};
+
+/**
+ * @brief Whether the values of type `T` are sign-extended by the type-erased core.
+ */
+template<typename T>
+inline constexpr bool kSignedValue{std::is_signed_v<typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::common_type<T>>::type>};
+
+/**
+ * @brief Widens a value the way `loadValue` reads it from an entry.
+ *
+ * @param value The value to widen.
+ * @return The value as 64 bits, sign-extended for signed types.
+ */
+template<typename T>
+uint64_t erasedKey(T value)
+{
+    using Underlying = typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::common_type<T>>::type;
+    const auto raw{static_cast<Underlying>(value)};
+    if constexpr (std::is_signed_v<Underlying>)
+    {
+        return static_cast<uint64_t>(static_cast<int64_t>(raw));
+    }
+    else
+    {
+        return static_cast<uint64_t>(raw);
+    }
+}
+
+/**
+ * @brief Describes an array of Enum entries for the type-erased core.
+ *
+ * @param entries The array of Enum entries.
+ * @return The descriptor of the array.
+ */
+template<typename T, size_t N, typename CharT>
+EntryTable entryTable(const std::array<Enum<T, CharT>, N>& entries)
+{
+    return EntryTable{reinterpret_cast<const unsigned char*>(entries.data()), N, sizeof(Enum<T, CharT>)};
+}
+
+/**
+ * @brief Binary-searches a value in the sorted range `[left, right)` of the entries.
+ *
+ * @param value The value to search for.
+ * @param entries The array of Enum entries, sorted by value.
+ * @param left The first slot of the range.
+ * @param right One past the last slot of the range.
+ * @return The slot of the value, or `N` if it is not in the range.
+ */
+template<typename T, size_t N, typename CharT>
+constexpr size_t binarySearch(T value, const std::array<Enum<T, CharT>, N>& entries, size_t left, size_t right)
+{
+    while (left < right)
+    {
+        const size_t mid{left + (right - left) / 2};
+        if (entries[mid].value == value)
+        {
+            return mid;
+        }
+        if (entries[mid].value < value)
+        {
+            left = mid + 1;
+        }
+        else
+        {
+            right = mid;
+        }
+    }
+    return N;
+}
+} // namespace detail
+
 /**
  * @brief Holds an array of Enum entries and provides methods to retrieve them.
  *
+ * Declare the holder `constexpr` so that policies with an index build it at compile time.
+ *
  * @tparam T The type of the enum value.
  * @tparam N The number of enum entries.
  * @tparam EnumSearchPolicy The policy for searching by value.
  * @tparam StringSearchPolicy The policy for searching by name.
  * @tparam UnknownPolicy The policy for handling unknown enums.
+ * @tparam CharT The character type of the names.
  */
-template<typename T, size_t N, class EnumSearchPolicy, class StringSearchPolicy, class UnknownPolicy>
+template<typename T, size_t N, class EnumSearchPolicy, class StringSearchPolicy, class UnknownPolicy, typename CharT = char>
 struct EnumHolder
 {
+    using char_type = CharT; ///< The character type of the names.
+
+    /**
+     * @brief Creates a holder over an array of Enum entries and builds the policy indices.
+     *
+     * @param entries The array of Enum entries, which must outlive the holder.
+     */
+    constexpr EnumHolder(const std::array<Enum<T, CharT>, N>& entries)
+        : m_entries(entries),
+          m_valueIndex(entries),
+          m_stringIndex(entries)
+    {
+    }
+
     /**
      * @brief Retrieves an Enum entry from a value.
      *
      * @param value The enum value to search for.
      * @return The corresponding Enum entry.
      */
-    constexpr Enum<T> fromValue(T value) const
+    constexpr Enum<T, CharT> fromValue(T value) const
     {
-        Enum<T> result{EnumSearchPolicy::template search<T, N>(value, m_entries)};
-        if (result == default_unknown_enum<T>())
+        TRLC_ENUM_TRACE_BEGIN(traceStart);
+        Enum<T, CharT> result{m_valueIndex.search(value, m_entries)};
+        const bool found{!(result == default_unknown_enum<T, CharT>())};
+        if (!found)
         {
             result = UnknownPolicy::template handle<T>(value, m_entries);
         }
+        TRLC_ENUM_TRACE_END(traceStart, EnumSearchPolicy, detail::TraceKind::Value, value, found)
         return result;
     }
 
@@ -91,27 +461,74 @@ struct EnumHolder
      * @param name The name to search for.
      * @return The corresponding Enum entry.
      */
-    constexpr Enum<T> fromString(std::string_view name) const
+    constexpr Enum<T, CharT> fromString(std::basic_string_view<CharT> name) const
     {
-        Enum<T> result{StringSearchPolicy::template search<T, N>(name, m_entries)};
-        if (result == default_unknown_enum<T>())
+#if defined(TRLC_ENUM_NAMELESS)
+        static_assert(detail::kAlwaysFalse<T>, "fromString is unavailable when TRLC_ENUM_NAMELESS strips the names");
+#endif
+        TRLC_ENUM_TRACE_BEGIN(traceStart);
+        Enum<T, CharT> result{m_stringIndex.search(name, m_entries)};
+        const bool found{!(result == default_unknown_enum<T, CharT>())};
+        if (!found)
         {
             result = UnknownPolicy::template handle<T>(name, m_entries);
         }
+        TRLC_ENUM_TRACE_END(traceStart, StringSearchPolicy, detail::TraceKind::String, name, found)
         return result;
     }
 
+    /**
+     * @brief Returns the slot of the entry holding a value, for indexing per-entry data such as an `EnumSet`.
+     *
+     * The unknown policy is not consulted.
+     *
+     * @param value The enum value to search for.
+     * @return The slot of the entry, or `N` if no entry holds the value.
+     */
+    constexpr size_t indexFromValue(T value) const
+    {
+        return m_valueIndex.find(value, m_entries);
+    }
+
+    /**
+     * @brief Returns the slot of the entry with a name, for indexing per-entry data such as an `EnumSet`.
+     *
+     * The unknown policy is not consulted.
+     *
+     * @param name The name to search for.
+     * @return The slot of the entry, or `N` if no entry has the name.
+     */
+    constexpr size_t indexFromString(std::basic_string_view<CharT> name) const
+    {
+#if defined(TRLC_ENUM_NAMELESS)
+        static_assert(detail::kAlwaysFalse<T>, "indexFromString is unavailable when TRLC_ENUM_NAMELESS strips the names");
+#endif
+        return m_stringIndex.find(name, m_entries);
+    }
+
+    /**
+     * @brief Returns the number of entries.
+     */
+    static constexpr size_t size()
+    {
+        return N;
+    }
+
     /**
      * @brief Retrieves all Enum values.
      *
      * @return An array of all Enum values.
      */
-    constexpr const std::array<Enum<T>, N> allValues() const
+    constexpr const std::array<Enum<T, CharT>, N> allValues() const
     {
         return m_entries;
     }
 
-    const std::array<Enum<T>, N>& m_entries; ///< The array of Enum entries.
+    const std::array<Enum<T, CharT>, N>& m_entries; ///< The array of Enum entries.
+
+private:
+    detail::PolicyIndex<EnumSearchPolicy, T, N, CharT> m_valueIndex;    ///< The state of the value search policy.
+    detail::PolicyIndex<StringSearchPolicy, T, N, CharT> m_stringIndex; ///< The state of the string search policy.
 };
 
 namespace policy
@@ -123,25 +540,46 @@ namespace policy
 struct LinearSearchPolicy
 {
     /**
-     * @brief Searches for an Enum entry by value.
+     * @brief Finds the slot of the first entry holding a value.
      *
      * @param value The value to search for.
      * @param entries The array of Enum entries.
-     * @return The corresponding Enum entry.
+     * @return The slot of the entry, or `N` if no entry holds the value.
      */
-    template<typename T, size_t N>
-    static constexpr Enum<T> search(T value, const std::array<Enum<T>, N>& entries)
+    template<typename T, size_t N, typename CharT>
+    static constexpr size_t find(T value, const std::array<Enum<T, CharT>, N>& entries)
     {
-        Enum<T> result{default_unknown_enum<T>()};
-        for (const auto& entry : entries)
+#if defined(TRLC_ENUM_ERASED_CORE)
+        if constexpr (detail::kErasableValue<T, CharT>)
         {
-            if (entry.value == value)
+            if (!detail::isConstantEvaluated())
             {
-                result = entry;
-                break;
+                return detail::findValue(detail::entryTable(entries), detail::erasedKey(value), sizeof(T), detail::kSignedValue<T>);
             }
         }
-        return result;
+#endif
+        for (size_t index{0}; index < N; ++index)
+        {
+            if (entries[index].value == value)
+            {
+                return index;
+            }
+        }
+        return N;
+    }
+
+    /**
+     * @brief Searches for an Enum entry by value.
+     *
+     * @param value The value to search for.
+     * @param entries The array of Enum entries.
+     * @return The corresponding Enum entry.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr Enum<T, CharT> search(T value, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        const size_t index{find(value, entries)};
+        return index < N ? entries[index] : default_unknown_enum<T, CharT>();
     }
 };
 
@@ -151,6 +589,28 @@ struct LinearSearchPolicy
  */
 struct SortedSearchPolicy
 {
+    /**
+     * @brief Finds the slot of the entry holding a value using binary search.
+     *
+     * @param value The value to search for.
+     * @param entries The array of Enum entries, sorted by value.
+     * @return The slot of the entry, or `N` if no entry holds the value.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr size_t find(T value, const std::array<Enum<T, CharT>, N>& entries)
+    {
+#if defined(TRLC_ENUM_ERASED_CORE)
+        if constexpr (detail::kErasableValue<T, CharT>)
+        {
+            if (!detail::isConstantEvaluated())
+            {
+                return detail::findSortedValue(detail::entryTable(entries), detail::erasedKey(value), sizeof(T), detail::kSignedValue<T>);
+            }
+        }
+#endif
+        return detail::binarySearch(value, entries, 0, N);
+    }
+
     /**
      * @brief Searches for an Enum entry by value using binary search.
      *
@@ -158,22 +618,130 @@ struct SortedSearchPolicy
      * @param entries The array of Enum entries.
      * @return The corresponding Enum entry.
      */
-    template<typename T, size_t N>
-    static constexpr Enum<T> search(T value, const std::array<Enum<T>, N>& entries)
+    template<typename T, size_t N, typename CharT>
+    static constexpr Enum<T, CharT> search(T value, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        const size_t index{find(value, entries)};
+        return index < N ? entries[index] : default_unknown_enum<T, CharT>();
+    }
+};
+
+// InterpolationSearchPolicy definition
+/**
+ * @brief Search policy that guesses the slot of a value from its position between the smallest and
+ * the largest value, for sorted entries with near-uniform values.
+ *
+ * The holder measures at compile time how far any entry lies from its guessed slot and only
+ * binary-searches that window, so typical lookups take two or three probes. When the values are
+ * not uniform enough the window grows past `kMaxWindow` and the policy falls back to a plain
+ * binary search.
+ */
+struct InterpolationSearchPolicy
+{
+    static constexpr size_t kMaxWindow{8}; ///< Largest distance between guessed and actual slot that keeps interpolation.
+
+    /**
+     * @brief Guessed slots of the entries of a holder.
+     */
+    template<typename T, size_t N, typename CharT>
+    class Index
     {
-        // Perform binary search
-        Enum<T> result{default_unknown_enum<T>()};
-        size_t left = 0;
-        size_t right = N - 1;
+    public:
+        constexpr explicit Index(const std::array<Enum<T, CharT>, N>& entries)
+            : m_window(window(entries))
+        {
+            if (N > 0)
+            {
+                m_min = detail::orderedKey(entries[0].value);
+                m_span = detail::orderedKey(entries[N - 1].value) - m_min;
+            }
+        }
 
-        while (left <= right)
+        /**
+         * @brief Finds the slot of a value around its interpolated slot.
+         *
+         * @param value The value to search for.
+         * @param entries The array of Enum entries.
+         * @return The slot of the entry, or `N` if no entry holds the value.
+         */
+        constexpr size_t find(T value, const std::array<Enum<T, CharT>, N>& entries) const
         {
-            size_t mid = left + (right - left) / 2;
+            size_t left{0};
+            size_t right{N};
+            if (m_window <= kMaxWindow)
+            {
+                const uint64_t key{detail::orderedKey(value)};
+                if (key < m_min || key - m_min > m_span)
+                {
+                    return N;
+                }
+                // One extra slot on each side absorbs rounding differences between compile time and runtime.
+                const size_t guess{slot(key - m_min, m_span, N)};
+                left = guess > m_window + 1 ? guess - m_window - 1 : 0;
+                right = std::min(N, guess + m_window + 2);
+            }
+            return detail::binarySearch(value, entries, left, right);
+        }
+
+        /**
+         * @brief Searches for an Enum entry by value around its interpolated slot.
+         *
+         * @param value The value to search for.
+         * @param entries The array of Enum entries.
+         * @return The corresponding Enum entry.
+         */
+        constexpr Enum<T, CharT> search(T value, const std::array<Enum<T, CharT>, N>& entries) const
+        {
+            const size_t index{find(value, entries)};
+            return index < N ? entries[index] : default_unknown_enum<T, CharT>();
+        }
 
+    private:
+        uint64_t m_min{0};  ///< Ordered key of the smallest value.
+        uint64_t m_span{0}; ///< Distance between the ordered keys of the smallest and largest values.
+        size_t m_window{0}; ///< Largest distance between the guessed and the actual slot of an entry.
+    };
+
+    /**
+     * @brief Returns whether sorted entries are uniform enough for interpolation to apply.
+     *
+     * @param entries The array of Enum entries, sorted by value.
+     * @return `true` if every entry lies within `kMaxWindow` slots of its guess, otherwise `false`.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr bool isUniform(const std::array<Enum<T, CharT>, N>& entries)
+    {
+        return window(entries) <= kMaxWindow;
+    }
+
+    /**
+     * @brief Finds the slot of a value without a precomputed window.
+     *
+     * Narrows the range with up to `kMaxSteps` interpolation probes, then binary-searches the rest.
+     *
+     * @param value The value to search for.
+     * @param entries The array of Enum entries, sorted by value.
+     * @return The slot of the entry, or `N` if no entry holds the value.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr size_t find(T value, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        constexpr size_t kMaxSteps{3};
+        const uint64_t key{detail::orderedKey(value)};
+        size_t left{0};
+        size_t right{N};
+        for (size_t step{0}; step < kMaxSteps && right - left > 2; ++step)
+        {
+            const uint64_t low{detail::orderedKey(entries[left].value)};
+            const uint64_t high{detail::orderedKey(entries[right - 1].value)};
+            if (key < low || key > high)
+            {
+                return N;
+            }
+            const size_t mid{left + slot(key - low, high - low, right - left)};
             if (entries[mid].value == value)
             {
-                result = entries[mid];
-                break;
+                return mid;
             }
             if (entries[mid].value < value)
             {
@@ -181,9 +749,47 @@ struct SortedSearchPolicy
             }
             else
             {
-                right = mid - 1;
+                right = mid;
             }
         }
+        return detail::binarySearch(value, entries, left, right);
+    }
+
+    /**
+     * @brief Searches for an Enum entry by value without a precomputed window.
+     *
+     * @param value The value to search for.
+     * @param entries The array of Enum entries, sorted by value.
+     * @return The corresponding Enum entry.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr Enum<T, CharT> search(T value, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        const size_t index{find(value, entries)};
+        return index < N ? entries[index] : default_unknown_enum<T, CharT>();
+    }
+
+private:
+    static constexpr size_t slot(uint64_t offset, uint64_t span, size_t count)
+    {
+        return span == 0 ? 0 : static_cast<size_t>(static_cast<double>(offset) / static_cast<double>(span) * static_cast<double>(count - 1));
+    }
+
+    template<typename T, size_t N, typename CharT>
+    static constexpr size_t window(const std::array<Enum<T, CharT>, N>& entries)
+    {
+        size_t result{0};
+        if (N == 0)
+        {
+            return result;
+        }
+        const uint64_t min{detail::orderedKey(entries[0].value)};
+        const uint64_t span{detail::orderedKey(entries[N - 1].value) - min};
+        for (size_t index{0}; index < N; ++index)
+        {
+            const size_t guess{slot(detail::orderedKey(entries[index].value) - min, span, N)};
+            result = std::max(result, guess > index ? guess - index : index - guess);
+        }
         return result;
     }
 };
@@ -195,26 +801,47 @@ struct SortedSearchPolicy
 struct CaseSensitiveStringSearchPolicy
 {
     /**
-     * @brief Searches for an Enum entry by name.
+     * @brief Finds the slot of the first entry with a name.
      *
      * @param name The name to search for.
      * @param entries The array of Enum entries.
-     * @return The corresponding Enum entry.
+     * @return The slot of the entry, or `N` if no entry has the name.
      */
-    template<typename T, size_t N>
-    static constexpr Enum<T> search(std::string_view name, const std::array<Enum<T>, N>& entries)
+    template<typename T, size_t N, typename CharT>
+    static constexpr size_t find(detail::TypeIdentityT<std::basic_string_view<CharT>> name, const std::array<Enum<T, CharT>, N>& entries)
     {
-        Enum<T> result{default_unknown_enum<T>()};
-        for (const auto& entry : entries)
+#if defined(TRLC_ENUM_ERASED_CORE)
+        using Entry = Enum<T, CharT>;
+        if constexpr (std::is_same_v<CharT, char> && std::is_standard_layout_v<Entry>)
+        {
+            if (!detail::isConstantEvaluated())
+            {
+                return detail::findName(detail::entryTable(entries), offsetof(Entry, name), name);
+            }
+        }
+#endif
+        for (size_t index{0}; index < N; ++index)
         {
-            if (entry.name == name)
+            if (detail::sameName(entries[index].name, name))
             {
-                result = entry;
-                break; // Added break here to stop on first match
+                return index;
             }
         }
+        return N;
+    }
 
-        return result;
+    /**
+     * @brief Searches for an Enum entry by name.
+     *
+     * @param name The name to search for.
+     * @param entries The array of Enum entries.
+     * @return The corresponding Enum entry.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr Enum<T, CharT> search(detail::TypeIdentityT<std::basic_string_view<CharT>> name, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        const size_t index{find<T, N, CharT>(name, entries)};
+        return index < N ? entries[index] : default_unknown_enum<T, CharT>();
     }
 };
 
@@ -227,35 +854,59 @@ struct CaseInsensitiveStringSearchPolicy
     /**
      * @brief Compares two characters for case-insensitive equality.
      *
+     * `char` goes through `std::tolower`; wider character types fold ASCII letters only.
+     *
      * @param a The first character.
      * @param b The second character.
      * @return True if the characters are equal, false otherwise.
      */
-    static constexpr bool caseInsensitiveEqual(char a, char b)
+    template<typename CharT>
+    static constexpr bool caseInsensitiveEqual(CharT a, CharT b)
     {
-        return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+        if constexpr (std::is_same_v<CharT, char>)
+        {
+            return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+        }
+        else
+        {
+            const auto lower = [](CharT c) { return (c >= CharT('A') && c <= CharT('Z')) ? static_cast<CharT>(c + ('a' - 'A')) : c; };
+            return lower(a) == lower(b);
+        }
     }
 
     /**
-     * @brief Searches for an Enum entry by name using case-insensitive comparison.
+     * @brief Finds the slot of the first entry with a name using case-insensitive comparison.
      *
      * @param name The name to search for.
      * @param entries The array of Enum entries.
-     * @return The corresponding Enum entry.
+     * @return The slot of the entry, or `N` if no entry has the name.
      */
-    template<typename T, size_t N>
-    static constexpr Enum<T> search(std::string_view name, const std::array<Enum<T>, N>& entries)
+    template<typename T, size_t N, typename CharT>
+    static constexpr size_t find(detail::TypeIdentityT<std::basic_string_view<CharT>> name, const std::array<Enum<T, CharT>, N>& entries)
     {
-        Enum<T> result{default_unknown_enum<T>()};
-        for (const auto& entry : entries)
+        for (size_t index{0}; index < N; ++index)
         {
-            if (name.size() == entry.name.size() && std::equal(entry.name.begin(), entry.name.end(), name.begin(), caseInsensitiveEqual))
+            const auto& entryName{entries[index].name};
+            if (name.size() == entryName.size() && std::equal(entryName.begin(), entryName.end(), name.begin(), caseInsensitiveEqual<CharT>))
             {
-                result = entry;
-                break; // Added break here to stop on first match
+                return index;
             }
         }
-        return result;
+        return N;
+    }
+
+    /**
+     * @brief Searches for an Enum entry by name using case-insensitive comparison.
+     *
+     * @param name The name to search for.
+     * @param entries The array of Enum entries.
+     * @return The corresponding Enum entry.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr Enum<T, CharT> search(detail::TypeIdentityT<std::basic_string_view<CharT>> name, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        const size_t index{find<T, N, CharT>(name, entries)};
+        return index < N ? entries[index] : default_unknown_enum<T, CharT>();
     }
 };
 
@@ -268,26 +919,26 @@ struct UnknownPolicy
      * @brief Handles an unknown enum name.
      *
      * @param name The name of the unknown enum.
-     * @param entries The array of Enum entries.
+     * @param entries The entries of the holder (a `std::array`, a runtime container or the holder itself).
      * @return A default unknown Enum entry.
      */
-    template<typename T, size_t N>
-    static constexpr Enum<T> handle([[maybe_unused]] std::string_view name, [[maybe_unused]] const std::array<Enum<T>, N>& entries)
+    template<typename T, class Entries, typename CharT>
+    static constexpr Enum<T, CharT> handle([[maybe_unused]] std::basic_string_view<CharT> name, [[maybe_unused]] const Entries& entries)
     {
-        return default_unknown_enum<T>();
+        return default_unknown_enum<T, CharT>();
     }
 
     /**
      * @brief Handles an unknown enum value.
      *
      * @param value The unknown enum value.
-     * @param entries The array of Enum entries.
+     * @param entries The entries of the holder (a `std::array`, a runtime container or the holder itself).
      * @return A default unknown Enum entry.
      */
-    template<typename T, size_t N>
-    static constexpr Enum<T> handle([[maybe_unused]] T value, [[maybe_unused]] const std::array<Enum<T>, N>& entries)
+    template<typename T, class Entries>
+    static constexpr Enum<T, typename detail::EntriesChar<Entries>::type> handle([[maybe_unused]] T value, [[maybe_unused]] const Entries& entries)
     {
-        return default_unknown_enum<T>();
+        return default_unknown_enum<T, typename detail::EntriesChar<Entries>::type>();
     }
 };
 } // namespace policy
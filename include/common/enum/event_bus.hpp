@@ -0,0 +1,206 @@
+#pragma once
+#include "../define.hpp"
+#include "detail.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace trlc
+{
+
+namespace detail
+{
+/// Size of a cache line; fields written by different threads are kept this far apart.
+inline constexpr size_t kCacheLineBytes{64};
+
+/**
+ * @brief Bounded lock-free queue for one producer thread and one consumer thread.
+ *
+ * The producer and the consumer positions live on separate cache lines, and each side keeps a
+ * private copy of the other side's position so it only reads the shared one when the ring looks
+ * full or empty.
+ *
+ * @tparam Event The type of the events, default constructible and movable.
+ * @tparam Capacity The number of slots, a power of two.
+ */
+template<typename Event, size_t Capacity>
+class SpscRing
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+    UNCOPYABLE(SpscRing)
+
+    SpscRing() = default;
+
+    /**
+     * @brief Appends an event; called by the producer thread only.
+     *
+     * @param event The event to append.
+     * @return `true` if the event was appended, `false` if the ring is full.
+     */
+    template<typename E>
+    bool push(E&& event)
+    {
+        const size_t tail{m_tail.load(std::memory_order_relaxed)};
+        if (tail - m_cachedHead == Capacity)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead == Capacity)
+            {
+                return false;
+            }
+        }
+        m_slots[tail & (Capacity - 1)] = std::forward<E>(event);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consumes up to `limit` events; called by the consumer thread only.
+     *
+     * The slots are released to the producer once, after the whole batch.
+     *
+     * @param consume Called as `consume(Event&&)` for each event, in order.
+     * @param limit The largest number of events to consume.
+     * @return The number of events consumed.
+     */
+    template<class Consume>
+    size_t drain(Consume&& consume, size_t limit)
+    {
+        const size_t head{m_head.load(std::memory_order_relaxed)};
+        if (m_cachedTail - head < limit)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+        }
+        const size_t count{std::min(m_cachedTail - head, limit)};
+        for (size_t offset{0}; offset < count; ++offset)
+        {
+            consume(std::move(m_slots[(head + offset) & (Capacity - 1)]));
+        }
+        if (count > 0)
+        {
+            m_head.store(head + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of queued events, exact only when neither side is running.
+     */
+    size_t size() const
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+private:
+    alignas(kCacheLineBytes) std::atomic<size_t> m_head{0}; ///< Next slot to consume, written by the consumer.
+    size_t m_cachedTail{0};                                 ///< The consumer's copy of `m_tail`.
+    alignas(kCacheLineBytes) std::atomic<size_t> m_tail{0}; ///< Next slot to fill, written by the producer.
+    size_t m_cachedHead{0};                                 ///< The producer's copy of `m_head`.
+    alignas(kCacheLineBytes) std::array<Event, Capacity> m_slots{}; ///< The queued events.
+};
+} // namespace detail
+
+/**
+ * @brief Dispatches events tagged with an enum message type without a shared queue.
+ *
+ * Every message type of the holder gets its own lane, and every lane holds one SPSC ring per
+ * producer, so producers never contend with each other and types never contend at all. Each
+ * producer publishes with its own id from one thread; each lane is drained by one consumer thread.
+ *
+ * @tparam Holder The `EnumHolder` of the message types.
+ * @tparam Event The type of the events, default constructible and movable.
+ * @tparam Producers The number of producer threads.
+ * @tparam Capacity The number of events per ring, a power of two.
+ */
+template<class Holder, typename Event, size_t Producers = 1, size_t Capacity = 1024>
+class EventBus
+{
+    using Ring = detail::SpscRing<Event, Capacity>;
+
+public:
+    UNCOPYABLE(EventBus)
+
+    /**
+     * @brief Creates the lanes of every message type of a holder.
+     *
+     * @param holder The holder of the message types, which must outlive the bus.
+     */
+    explicit EventBus(const Holder& holder)
+        : m_holder(holder),
+          m_rings(new Ring[Holder::size() * Producers])
+    {
+    }
+
+    /**
+     * @brief Publishes an event to the lane of its type.
+     *
+     * @param producer The id of the calling producer, below `Producers`.
+     * @param type The message type.
+     * @param event The event.
+     * @return `true` if the event was queued, `false` if the type is unknown, the producer id is out of range or the ring is full.
+     */
+    template<typename T, typename E>
+    bool publish(size_t producer, T type, E&& event)
+    {
+        const size_t lane{m_holder.indexFromValue(type)};
+        if (lane >= Holder::size() || producer >= Producers)
+        {
+            return false;
+        }
+        return m_rings[lane * Producers + producer].push(std::forward<E>(event));
+    }
+
+    /**
+     * @brief Consumes the queued events of one message type in a batch.
+     *
+     * Events of one producer are consumed in publication order.
+     *
+     * @param type The message type.
+     * @param consume Called as `consume(Event&&)` for each event.
+     * @param limit The largest number of events to consume.
+     * @return The number of events consumed.
+     */
+    template<typename T, class Consume>
+    size_t drain(T type, Consume&& consume, size_t limit = Capacity * Producers)
+    {
+        const size_t lane{m_holder.indexFromValue(type)};
+        if (lane >= Holder::size())
+        {
+            return 0;
+        }
+        size_t count{0};
+        for (size_t producer{0}; producer < Producers && count < limit; ++producer)
+        {
+            count += m_rings[lane * Producers + producer].drain(consume, limit - count);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of queued events of one message type, exact only when the bus is idle.
+     */
+    template<typename T>
+    size_t pending(T type) const
+    {
+        const size_t lane{m_holder.indexFromValue(type)};
+        size_t count{0};
+        for (size_t producer{0}; lane < Holder::size() && producer < Producers; ++producer)
+        {
+            count += m_rings[lane * Producers + producer].size();
+        }
+        return count;
+    }
+
+private:
+    const Holder& m_holder;          ///< The message types.
+    std::unique_ptr<Ring[]> m_rings; ///< `Producers` rings per message type, lane by lane.
+};
+
+} // namespace trlc
\ No newline at end of file
@@ -0,0 +1,314 @@
+#pragma once
+#include "../define.hpp"
+#include "detail.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace trlc
+{
+
+/**
+ * @brief An entry decoded from compressed name storage.
+ *
+ * The name is decoded into an inline buffer, so the entry stays valid independently of the holder.
+ *
+ * @tparam T The type of the enum value.
+ * @tparam Capacity The maximum name length.
+ */
+template<typename T, size_t Capacity>
+struct DecodedEnum
+{
+    T value{};                       ///< The enum value.
+    uint32_t size{0};                ///< The length of the name.
+    std::array<char, Capacity> text; ///< The decoded name bytes.
+
+    /**
+     * @brief Returns the name associated with the enum value.
+     */
+    constexpr std::string_view name() const
+    {
+        return std::string_view{text.data(), size};
+    }
+
+    /**
+     * @brief Converts the entry to its underlying value type.
+     */
+    constexpr operator T() const
+    {
+        return value;
+    }
+};
+
+/**
+ * @brief Holds runtime Enum entries with names sorted and front-coded in blocks.
+ *
+ * Every block stores its first name in full followed by names encoded as (shared prefix length,
+ * suffix). `fromString` binary-searches the block heads and decodes one block; `fromValue` maps the
+ * value to its name rank through a sorted index and decodes up to that rank. Vocabularies whose
+ * names share long prefixes (`ERROR_NETWORK_TIMEOUT_*`) need a fraction of the memory of
+ * `RuntimeEnumHolder`.
+ *
+ * @tparam T The type of the enum value.
+ * @tparam UnknownPolicy The policy for handling unknown enums.
+ * @tparam MaxNameLength The longest name the holder accepts; see `create` for rejecting longer names.
+ * @tparam BlockSize The number of names per front-coded block.
+ */
+template<typename T, class UnknownPolicy = policy::UnknownPolicy, size_t MaxNameLength = 64, size_t BlockSize = 16>
+class FrontCodedEnumHolder
+{
+public:
+    using Definition = std::pair<T, std::string>;
+    using Entry = DecodedEnum<T, MaxNameLength>;
+    using Ptr = std::shared_ptr<const FrontCodedEnumHolder>;
+
+    UNCOPYABLE(FrontCodedEnumHolder)
+
+    /**
+     * @brief Builds a holder, refusing definitions that it could not keep.
+     *
+     * @param definitions The entries of the holder.
+     * @return The holder, or an empty pointer if a name is longer than `MaxNameLength`.
+     */
+    static Ptr create(const std::vector<Definition>& definitions)
+    {
+        auto holder{std::make_shared<const FrontCodedEnumHolder>(definitions)};
+        return holder->valid() ? Ptr{std::move(holder)} : Ptr{};
+    }
+
+    /**
+     * @brief Builds the compressed storage from value/name definitions.
+     *
+     * When several definitions share a name or a value, the first one wins, like the linear policies.
+     * Definitions with a name longer than `MaxNameLength` are left out, which `valid()` reports;
+     * use `create` to refuse them instead.
+     *
+     * @param definitions The entries of the holder.
+     */
+    explicit FrontCodedEnumHolder(const std::vector<Definition>& definitions)
+    {
+        std::vector<uint32_t> order;
+        order.reserve(definitions.size());
+        for (uint32_t index{0}; index < definitions.size(); ++index)
+        {
+            if (definitions[index].second.size() > MaxNameLength)
+            {
+                ++m_rejected;
+                continue;
+            }
+            order.push_back(index);
+        }
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs) { return definitions[lhs].second < definitions[rhs].second; });
+        order.erase(std::unique(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs) { return definitions[lhs].second == definitions[rhs].second; }), order.end());
+
+        std::string_view previous;
+        for (uint32_t rank{0}; rank < order.size(); ++rank)
+        {
+            std::string_view name{definitions[order[rank]].second};
+            if (rank % BlockSize == 0)
+            {
+                m_blocks.push_back(static_cast<uint32_t>(m_blob.size()));
+                appendVarint(name.size());
+            }
+            else
+            {
+                const size_t shared{static_cast<size_t>(std::mismatch(name.begin(), name.end(), previous.begin(), previous.end()).first - name.begin())};
+                appendVarint(shared);
+                appendVarint(name.size() - shared);
+                name.remove_prefix(shared);
+            }
+            m_blob.insert(m_blob.end(), name.begin(), name.end());
+            previous = definitions[order[rank]].second;
+            m_values.push_back(definitions[order[rank]].first);
+        }
+
+        // Ties on value keep the earliest definition, which is the smallest position in `order`.
+        std::vector<uint32_t> byValue(order.size());
+        for (uint32_t rank{0}; rank < byValue.size(); ++rank)
+        {
+            byValue[rank] = rank;
+        }
+        std::sort(byValue.begin(), byValue.end(), [&](uint32_t lhs, uint32_t rhs) {
+            if (m_values[lhs] == m_values[rhs])
+            {
+                return order[lhs] < order[rhs];
+            }
+            return m_values[lhs] < m_values[rhs];
+        });
+        byValue.erase(std::unique(byValue.begin(), byValue.end(), [&](uint32_t lhs, uint32_t rhs) { return m_values[lhs] == m_values[rhs]; }), byValue.end());
+        m_valueIndex = std::move(byValue);
+
+        m_blob.shrink_to_fit();
+        m_blocks.shrink_to_fit();
+        m_values.shrink_to_fit();
+    }
+
+    /**
+     * @brief Retrieves an entry from a value.
+     *
+     * @param value The enum value to search for.
+     * @return The corresponding entry.
+     */
+    Entry fromValue(T value) const
+    {
+        const auto it = std::lower_bound(m_valueIndex.begin(), m_valueIndex.end(), value, [this](uint32_t rank, T key) { return m_values[rank] < key; });
+        if (it == m_valueIndex.end() || !(m_values[*it] == value))
+        {
+            return toEntry(UnknownPolicy::template handle<T>(value, *this));
+        }
+
+        Entry entry{};
+        entry.value = value;
+        const size_t block{*it / BlockSize};
+        const uint8_t* cursor{m_blob.data() + m_blocks[block]};
+        entry.size = static_cast<uint32_t>(readVarint(cursor));
+        std::memcpy(entry.text.data(), cursor, entry.size);
+        cursor += entry.size;
+        for (size_t position{block * BlockSize}; position < *it; ++position)
+        {
+            decodeNext(cursor, entry);
+        }
+        return entry;
+    }
+
+    /**
+     * @brief Retrieves an entry from a string name.
+     *
+     * @param name The name to search for.
+     * @return The corresponding entry.
+     */
+    Entry fromString(std::string_view name) const
+    {
+        if (name.size() <= MaxNameLength && !m_blocks.empty())
+        {
+            // Find the last block whose head is not greater than the name.
+            const auto it = std::upper_bound(m_blocks.begin(), m_blocks.end(), name, [this](std::string_view key, uint32_t offset) { return key < blockHead(offset); });
+            if (it != m_blocks.begin())
+            {
+                const size_t block{static_cast<size_t>(it - m_blocks.begin()) - 1};
+                const size_t last{std::min((block + 1) * BlockSize, m_values.size())};
+
+                Entry entry{};
+                const uint8_t* cursor{m_blob.data() + m_blocks[block]};
+                entry.size = static_cast<uint32_t>(readVarint(cursor));
+                std::memcpy(entry.text.data(), cursor, entry.size);
+                cursor += entry.size;
+                for (size_t rank{block * BlockSize}; rank < last; ++rank)
+                {
+                    if (rank != block * BlockSize)
+                    {
+                        decodeNext(cursor, entry);
+                    }
+                    const std::string_view current{entry.name()};
+                    if (current == name)
+                    {
+                        entry.value = m_values[rank];
+                        return entry;
+                    }
+                    if (name < current)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+        return toEntry(UnknownPolicy::template handle<T>(name, *this));
+    }
+
+    /**
+     * @brief Returns the number of entries.
+     */
+    size_t size() const
+    {
+        return m_values.size();
+    }
+
+    /**
+     * @brief Returns whether every definition fit, i.e. no name exceeded `MaxNameLength`.
+     */
+    bool valid() const
+    {
+        return m_rejected == 0;
+    }
+
+    /**
+     * @brief Returns the number of definitions rejected because their name exceeds `MaxNameLength`.
+     */
+    size_t rejected() const
+    {
+        return m_rejected;
+    }
+
+    /**
+     * @brief Returns the heap bytes used by names, values and indices.
+     */
+    size_t memoryUsage() const
+    {
+        return m_blob.capacity() + m_blocks.capacity() * sizeof(uint32_t) + m_values.capacity() * sizeof(T) + m_valueIndex.capacity() * sizeof(uint32_t);
+    }
+
+private:
+    static size_t readVarint(const uint8_t*& cursor)
+    {
+        size_t result{0};
+        for (size_t shift{0};; shift += 7)
+        {
+            const uint8_t byte{*cursor++};
+            result |= static_cast<size_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return result;
+            }
+        }
+    }
+
+    void appendVarint(size_t value)
+    {
+        while (value >= 0x80)
+        {
+            m_blob.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        m_blob.push_back(static_cast<uint8_t>(value));
+    }
+
+    std::string_view blockHead(uint32_t offset) const
+    {
+        const uint8_t* cursor{m_blob.data() + offset};
+        const size_t length{readVarint(cursor)};
+        return std::string_view{reinterpret_cast<const char*>(cursor), length};
+    }
+
+    static void decodeNext(const uint8_t*& cursor, Entry& entry)
+    {
+        const size_t shared{readVarint(cursor)};
+        const size_t suffix{readVarint(cursor)};
+        std::memcpy(entry.text.data() + shared, cursor, suffix);
+        cursor += suffix;
+        entry.size = static_cast<uint32_t>(shared + suffix);
+    }
+
+    static Entry toEntry(const Enum<T>& unknown)
+    {
+        Entry entry{};
+        entry.value = unknown.value;
+        entry.size = static_cast<uint32_t>(std::min(unknown.name.size(), MaxNameLength));
+        std::copy_n(unknown.name.data(), entry.size, entry.text.data());
+        return entry;
+    }
+
+    std::vector<uint8_t> m_blob;        ///< Front-coded names, block after block.
+    std::vector<uint32_t> m_blocks;     ///< Offset of each block head in the blob.
+    std::vector<T> m_values;            ///< Values in name order.
+    std::vector<uint32_t> m_valueIndex; ///< Name ranks sorted by value.
+    size_t m_rejected{0};               ///< Definitions whose name was too long.
+};
+
+} // namespace trlc
\ No newline at end of file
@@ -0,0 +1,153 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string_view>
+
+namespace trlc
+{
+namespace detail
+{
+/**
+ * @brief The 128-bit key of a keyed hash.
+ */
+struct HashSeed
+{
+    uint64_t k0{0}; ///< The low half of the key.
+    uint64_t k1{0}; ///< The high half of the key.
+};
+
+inline uint64_t rotateLeft(uint64_t x, int bits)
+{
+    return (x << bits) | (x >> (64 - bits));
+}
+
+/**
+ * @brief Reads 8 bytes as a little-endian word.
+ */
+inline uint64_t loadLittleEndian(const unsigned char* bytes)
+{
+    uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+/**
+ * @brief Computes SipHash-c-d, a keyed hash whose outputs cannot be predicted without the key.
+ *
+ * @tparam C The number of compression rounds per 8-byte block.
+ * @tparam D The number of finalization rounds.
+ * @param key The key.
+ * @param data The bytes to hash.
+ * @param size The number of bytes.
+ * @return The 64-bit hash.
+ */
+template<int C, int D>
+uint64_t sipHash(const HashSeed& key, const void* data, size_t size)
+{
+    uint64_t v0{key.k0 ^ 0x736f6d6570736575ULL};
+    uint64_t v1{key.k1 ^ 0x646f72616e646f6dULL};
+    uint64_t v2{key.k0 ^ 0x6c7967656e657261ULL};
+    uint64_t v3{key.k1 ^ 0x7465646279746573ULL};
+    const auto rounds = [&](int count) {
+        for (int round{0}; round < count; ++round)
+        {
+            v0 += v1;
+            v1 = rotateLeft(v1, 13);
+            v1 ^= v0;
+            v0 = rotateLeft(v0, 32);
+            v2 += v3;
+            v3 = rotateLeft(v3, 16);
+            v3 ^= v2;
+            v0 += v3;
+            v3 = rotateLeft(v3, 21);
+            v3 ^= v0;
+            v2 += v1;
+            v1 = rotateLeft(v1, 17);
+            v1 ^= v2;
+            v2 = rotateLeft(v2, 32);
+        }
+    };
+
+    const auto* bytes{static_cast<const unsigned char*>(data)};
+    const size_t blocks{size & ~size_t{7}};
+    for (size_t offset{0}; offset < blocks; offset += 8)
+    {
+        const uint64_t block{loadLittleEndian(bytes + offset)};
+        v3 ^= block;
+        rounds(C);
+        v0 ^= block;
+    }
+
+    // The last block holds the remaining bytes and the length in its top byte.
+    uint64_t last{static_cast<uint64_t>(size) << 56};
+    for (size_t offset{blocks}; offset < size; ++offset)
+    {
+        last |= static_cast<uint64_t>(bytes[offset]) << (8 * (offset - blocks));
+    }
+    v3 ^= last;
+    rounds(C);
+    v0 ^= last;
+
+    v2 ^= 0xff;
+    rounds(D);
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+/**
+ * @brief Returns the random key of the process, drawn on first use.
+ *
+ * `std::random_device` is mixed with the clock and an address, so a deterministic
+ * `std::random_device` still yields a key that differs between runs.
+ */
+inline const HashSeed& processHashSeed()
+{
+    static const HashSeed seed{[]() {
+        std::random_device device;
+        const uint64_t entropy[4]{static_cast<uint64_t>(device()) << 32 | device(), static_cast<uint64_t>(device()) << 32 | device(),
+                                  static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count()),
+                                  static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&device))};
+        const HashSeed mixer{entropy[0], entropy[1]};
+        return HashSeed{sipHash<2, 4>(mixer, entropy, sizeof(entropy)), sipHash<2, 4>(mixer, entropy + 1, sizeof(entropy) - sizeof(entropy[0]))};
+    }()};
+    return seed;
+}
+
+/**
+ * @brief Returns a fresh key derived from the process key; each call returns a different one.
+ *
+ * Every hash index takes its own key, and takes a new one when it reseeds, so the layout of one
+ * index tells nothing about another.
+ */
+inline HashSeed nextHashSeed()
+{
+    static std::atomic<uint64_t> counter{0};
+    const uint64_t index{counter.fetch_add(1, std::memory_order_relaxed)};
+    const uint64_t low[2]{index, 0};
+    const uint64_t high[2]{index, 1};
+    return HashSeed{sipHash<1, 3>(processHashSeed(), low, sizeof(low)), sipHash<1, 3>(processHashSeed(), high, sizeof(high))};
+}
+
+/**
+ * @brief Computes the keyed SipHash-1-3 of a name, for hash indices over runtime names.
+ *
+ * Compile-time tables keep their deterministic hashes; this one is for names that may come from
+ * untrusted input, where a fixed hash lets crafted names collide on purpose.
+ *
+ * @param name The name to hash.
+ * @param seed The key of the index.
+ * @return The 64-bit hash of the name.
+ */
+template<typename CharT>
+uint64_t hashName(std::basic_string_view<CharT> name, const HashSeed& seed)
+{
+    return sipHash<1, 3>(seed, name.data(), name.size() * sizeof(CharT));
+}
+} // namespace detail
+} // namespace trlc
\ No newline at end of file
@@ -0,0 +1,171 @@
+#pragma once
+#include "detail.hpp"
+#include "set.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace trlc
+{
+
+/**
+ * @brief An `EnumHolder` whose entries form a forest, e.g. `Network > Timeout > Connect`.
+ *
+ * The parent of every entry is given by value; a parent value that is not in the table makes the
+ * entry a root. At construction, at compile time for a `constexpr` holder, the entries are numbered
+ * in pre-order (children in table order) and every entry gets the interval `[enter, exit)` of the
+ * positions of its subtree. An ancestor test is then two integer compares, and a subtree is a
+ * contiguous range of positions.
+ *
+ * @tparam Holder The `EnumHolder` type of the entries.
+ */
+template<class Holder>
+class HierarchicalEnumHolder : public Holder
+{
+    using Entries = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<const Holder&>().m_entries)>>;
+    using T = decltype(std::declval<typename Entries::value_type>().value);
+    static constexpr size_t N{Holder::size()};
+
+public:
+    /**
+     * @brief Creates a holder over the entries and numbers the tree they form.
+     *
+     * @param entries The array of Enum entries, which must outlive the holder.
+     * @param parents The parent value of each entry, in entry order.
+     */
+    constexpr HierarchicalEnumHolder(const Entries& entries, const std::array<T, N>& parents)
+        : Holder(entries)
+    {
+        // Children and roots are chained in table order; slot `N` is a virtual root above the roots.
+        std::array<size_t, N + 1> firstChild{};
+        std::array<size_t, N + 1> nextSibling{};
+        for (size_t index{0}; index <= N; ++index)
+        {
+            firstChild[index] = N;
+            nextSibling[index] = N;
+        }
+        for (size_t index{N}; index-- > 0;)
+        {
+            const size_t parent{Holder::indexFromValue(parents[index])};
+            m_parents[index] = parent == index ? N : parent;
+            nextSibling[index] = firstChild[m_parents[index]];
+            firstChild[m_parents[index]] = index;
+        }
+
+        size_t position{0};
+        size_t node{firstChild[N]};
+        while (node != N)
+        {
+            m_enter[node] = position;
+            m_order[position++] = node;
+            if (firstChild[node] != N)
+            {
+                node = firstChild[node];
+                continue;
+            }
+            // Close finished subtrees until one has a next sibling.
+            while (node != N && nextSibling[node] == N)
+            {
+                m_exit[node] = position;
+                node = m_parents[node];
+            }
+            if (node != N)
+            {
+                m_exit[node] = position;
+                node = nextSibling[node];
+            }
+        }
+        // Entries on a parent cycle are never reached from a root.
+        m_valid = position == N;
+    }
+
+    /**
+     * @brief Returns whether the parents form a forest, i.e. have no cycle; `static_assert` it on a `constexpr` holder.
+     */
+    constexpr bool valid() const
+    {
+        return m_valid;
+    }
+
+    /**
+     * @brief Returns the slot of the parent of an entry.
+     *
+     * @param index The slot of the entry.
+     * @return The slot of the parent, or `N` for a root or an unknown slot.
+     */
+    constexpr size_t parent(size_t index) const
+    {
+        return index < N ? m_parents[index] : N;
+    }
+
+    /**
+     * @brief Returns whether an entry lies in the subtree of another one, itself included.
+     *
+     * @param index The slot of the entry.
+     * @param ancestor The slot of the root of the subtree.
+     * @return `true` if `ancestor` is `index` or one of its ancestors, otherwise `false`.
+     */
+    constexpr bool isWithin(size_t index, size_t ancestor) const
+    {
+        return index < N && ancestor < N && m_enter[ancestor] <= m_enter[index] && m_enter[index] < m_exit[ancestor];
+    }
+
+    /**
+     * @brief Returns whether the entry holding a value lies in the subtree of the entry holding another value.
+     *
+     * @param value The value of the entry.
+     * @param ancestor The value of the root of the subtree.
+     * @return `true` if `ancestor` is `value` or one of its ancestors, otherwise `false`.
+     */
+    constexpr bool isWithin(T value, T ancestor) const
+    {
+        return isWithin(Holder::indexFromValue(value), Holder::indexFromValue(ancestor));
+    }
+
+    /**
+     * @brief Returns the pre-order positions `[first, last)` of the subtree of an entry.
+     *
+     * @param index The slot of the root of the subtree.
+     * @return The range of positions, empty for an unknown slot. Map positions to slots with `slotAt`.
+     */
+    constexpr std::pair<size_t, size_t> subtreeRange(size_t index) const
+    {
+        return index < N ? std::pair<size_t, size_t>{m_enter[index], m_exit[index]} : std::pair<size_t, size_t>{0, 0};
+    }
+
+    /**
+     * @brief Returns the slot of the entry at a pre-order position.
+     */
+    constexpr size_t slotAt(size_t position) const
+    {
+        return position < N ? m_order[position] : N;
+    }
+
+    /**
+     * @brief Returns the entries of the subtree of an entry, itself included.
+     *
+     * @param index The slot of the root of the subtree.
+     * @return The set of the slots of the subtree, empty for an unknown slot.
+     */
+    constexpr EnumSet<N> subtree(size_t index) const
+    {
+        EnumSet<N> result{};
+        const auto [first, last] = subtreeRange(index);
+        for (size_t position{first}; position < last; ++position)
+        {
+            result.set(m_order[position]);
+        }
+        return result;
+    }
+
+private:
+    std::array<size_t, N> m_parents{}; ///< Slot of the parent of each entry, `N` for roots.
+    std::array<size_t, N> m_enter{};   ///< Pre-order position of each entry.
+    std::array<size_t, N> m_exit{};    ///< One past the pre-order position of the last entry of each subtree.
+    std::array<size_t, N> m_order{};   ///< Slot of the entry at each pre-order position.
+    bool m_valid{false};               ///< Whether every entry was reached from a root.
+};
+
+} // namespace trlc
\ No newline at end of file
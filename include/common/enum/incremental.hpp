@@ -0,0 +1,555 @@
+#pragma once
+#include "../define.hpp"
+#include "runtime.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace trlc
+{
+
+/**
+ * @brief Holds runtime Enum entries that can be added, removed and renamed while readers look them up.
+ *
+ * Each change publishes a new immutable version. Versions share everything that did not change:
+ * names live in hash buckets and values in sorted chunks, both reached through two-level
+ * directories of `kPageSize`-pointer pages. A change copies the buckets and chunks it touches, the
+ * pages holding them and the top-level page lists, i.e. O(changed entries + N / 512) pointers
+ * instead of rebuilding the indices over every entry; growing the buckets still rehashes every name.
+ * Readers never wait for an edit in progress and keep a consistent view for as long as they hold a
+ * snapshot. Writers are serialized by a mutex.
+ * Versions are published through `detail::AtomicSharedPtr`, which libstdc++ implements with a short
+ * internal lock (a mutex pool before C++20, a spin bit in `std::atomic<std::shared_ptr>`), so a
+ * `snapshot()` call may briefly wait for a concurrent load or publish.
+ * Names are hashed with a random key, and a bucket that grows past `kMaxBucket` names rehashes
+ * the names under a new key, so crafted names cannot pile up in one bucket.
+ *
+ * Names and values are unique: a change that would duplicate either is rejected.
+ *
+ * @tparam T The type of the enum value.
+ * @tparam UnknownPolicy The policy for handling unknown enums.
+ * @tparam CharT The character type of the names.
+ */
+template<typename T, class UnknownPolicy = policy::UnknownPolicy, typename CharT = char>
+class IncrementalEnumHolder
+{
+    struct Node
+    {
+        T value{};                     ///< The enum value.
+        std::basic_string<CharT> name; ///< The owned name.
+    };
+
+    using NodePtr = std::shared_ptr<const Node>;
+    using Bucket = std::vector<NodePtr>; ///< Nodes of one hash bucket, or of one value chunk sorted by value.
+    using BucketPtr = std::shared_ptr<Bucket>;
+    using Page = std::vector<BucketPtr>; ///< A page of a directory of buckets or chunks.
+    using PagePtr = std::shared_ptr<Page>;
+
+public:
+    using Definition = std::pair<T, std::basic_string<CharT>>;
+
+    static constexpr size_t kBucketLoad{8}; ///< Average names per hash bucket before the buckets double.
+    static constexpr size_t kMaxBucket{64}; ///< Names in one hash bucket before the names are rehashed under a new key.
+    static constexpr size_t kChunkSize{64}; ///< Values per sorted chunk; a chunk splits at twice this size.
+    static constexpr size_t kPageSize{64};  ///< Buckets per directory page; a page of chunks splits at twice this size.
+
+    /**
+     * @brief An immutable version of the entries.
+     *
+     * Names returned by lookups stay valid as long as the snapshot is alive.
+     */
+    class Snapshot
+    {
+    public:
+        using value_type = Enum<T, CharT>;
+
+        /**
+         * @brief Retrieves an Enum entry from a value.
+         *
+         * @param value The enum value to search for.
+         * @return The corresponding Enum entry.
+         */
+        Enum<T, CharT> fromValue(T value) const
+        {
+            const Node* node{findValue(value)};
+            return node ? Enum<T, CharT>{node->value, node->name} : UnknownPolicy::template handle<T>(value, *this);
+        }
+
+        /**
+         * @brief Retrieves an Enum entry from a string name.
+         *
+         * @param name The name to search for.
+         * @return The corresponding Enum entry.
+         */
+        Enum<T, CharT> fromString(std::basic_string_view<CharT> name) const
+        {
+            const Node* node{findName(name)};
+            return node ? Enum<T, CharT>{node->value, node->name} : UnknownPolicy::template handle<T>(name, *this);
+        }
+
+        /**
+         * @brief Returns whether an entry holds a value; the unknown policy is not consulted.
+         */
+        bool contains(T value) const
+        {
+            return findValue(value) != nullptr;
+        }
+
+        /**
+         * @brief Returns whether an entry has a name; the unknown policy is not consulted.
+         */
+        bool contains(std::basic_string_view<CharT> name) const
+        {
+            return findName(name) != nullptr;
+        }
+
+        /**
+         * @brief Retrieves all Enum entries sorted by value.
+         *
+         * @return The Enum entries.
+         */
+        std::vector<Enum<T, CharT>> allValues() const
+        {
+            std::vector<Enum<T, CharT>> entries;
+            entries.reserve(m_size);
+            for (const auto& page : m_chunkPages)
+            {
+                for (const auto& chunk : *page)
+                {
+                    for (const auto& node : *chunk)
+                    {
+                        entries.push_back(Enum<T, CharT>{node->value, node->name});
+                    }
+                }
+            }
+            return entries;
+        }
+
+        /**
+         * @brief Returns the number of entries.
+         */
+        size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Returns the version number, incremented by every published change.
+         */
+        uint64_t version() const
+        {
+            return m_version;
+        }
+
+    private:
+        friend class IncrementalEnumHolder;
+
+        /// The page and the slot in it of a value chunk.
+        struct ChunkPosition
+        {
+            size_t page{0}; ///< The page, or the number of pages when there is no chunk.
+            size_t slot{0}; ///< The chunk in the page.
+        };
+
+        const Node* findName(std::basic_string_view<CharT> name) const
+        {
+            for (const auto& node : *bucket(bucketOf(name)))
+            {
+                if (node->name == name)
+                {
+                    return node.get();
+                }
+            }
+            return nullptr;
+        }
+
+        const Node* findValue(T value) const
+        {
+            const ChunkPosition position{chunkOf(value)};
+            if (position.page == m_chunkPages.size())
+            {
+                return nullptr;
+            }
+            const Bucket& nodes{*(*m_chunkPages[position.page])[position.slot]};
+            const auto it = std::lower_bound(nodes.begin(), nodes.end(), value, [](const NodePtr& node, T key) { return node->value < key; });
+            return (it != nodes.end() && (*it)->value == value) ? it->get() : nullptr;
+        }
+
+        size_t bucketOf(std::basic_string_view<CharT> name) const
+        {
+            return detail::hashName(name, m_seed) & (m_bucketCount - 1);
+        }
+
+        const BucketPtr& bucket(size_t index) const
+        {
+            return (*m_bucketPages[index / kPageSize])[index % kPageSize];
+        }
+
+        /// Redistributes the names over `count` new buckets under a key.
+        void rehash(size_t count, const detail::HashSeed& seed)
+        {
+            std::vector<PagePtr> pages((count + kPageSize - 1) / kPageSize);
+            for (auto& page : pages)
+            {
+                page = std::make_shared<Page>(std::min(count, kPageSize));
+                for (auto& bucket : *page)
+                {
+                    bucket = std::make_shared<Bucket>();
+                }
+            }
+            for (const auto& page : m_bucketPages)
+            {
+                for (const auto& bucket : *page)
+                {
+                    for (const auto& node : *bucket)
+                    {
+                        const size_t index{detail::hashName(std::basic_string_view<CharT>{node->name}, seed) & (count - 1)};
+                        (*pages[index / kPageSize])[index % kPageSize]->push_back(node);
+                    }
+                }
+            }
+            m_bucketPages = std::move(pages);
+            m_bucketCount = count;
+            m_seed = seed;
+        }
+
+        /// The chunk whose range covers a value: the last chunk starting at or before it.
+        ChunkPosition chunkOf(T value) const
+        {
+            const auto page = std::upper_bound(m_chunkPages.begin(), m_chunkPages.end(), value, [](T key, const PagePtr& chunks) { return key < chunks->front()->front()->value; });
+            if (page == m_chunkPages.begin())
+            {
+                return ChunkPosition{m_chunkPages.size(), 0};
+            }
+            const Page& chunks{**(page - 1)};
+            const auto chunk = std::upper_bound(chunks.begin(), chunks.end(), value, [](T key, const BucketPtr& nodes) { return key < nodes->front()->value; });
+            return ChunkPosition{static_cast<size_t>(page - m_chunkPages.begin() - 1), static_cast<size_t>(chunk - chunks.begin() - 1)};
+        }
+
+        std::vector<PagePtr> m_bucketPages; ///< Pages of the hash buckets of the names, a power of two of buckets.
+        std::vector<PagePtr> m_chunkPages;  ///< Non-empty pages of non-empty value chunks, in value order.
+        size_t m_bucketCount{0};            ///< The number of hash buckets.
+        detail::HashSeed m_seed;            ///< The key of the name hash.
+        size_t m_size{0};                   ///< The number of entries.
+        uint64_t m_version{0};              ///< The version number.
+    };
+
+    using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
+    /**
+     * @brief Stages changes on top of the current version; obtained from `edit`.
+     *
+     * Pages, buckets and chunks are copied the first time a change touches them, then changed in place.
+     */
+    class Editor
+    {
+    public:
+        UNCOPYABLE(Editor)
+
+        /**
+         * @brief Adds an entry.
+         *
+         * @param value The enum value.
+         * @param name The name.
+         * @return `true` if the entry was added, `false` if the name or the value already exists.
+         */
+        bool add(T value, std::basic_string_view<CharT> name)
+        {
+            if (m_next->findName(name) || m_next->findValue(value))
+            {
+                return false;
+            }
+            insert(std::make_shared<const Node>(Node{value, std::basic_string<CharT>{name}}));
+            ++m_changes;
+            return true;
+        }
+
+        /**
+         * @brief Removes an entry.
+         *
+         * @param name The name of the entry.
+         * @return `true` if the entry was removed, `false` if the name does not exist.
+         */
+        bool remove(std::basic_string_view<CharT> name)
+        {
+            const Node* node{m_next->findName(name)};
+            if (!node)
+            {
+                return false;
+            }
+            const T value{node->value};
+            eraseName(name);
+            eraseValue(value);
+            ++m_changes;
+            return true;
+        }
+
+        /**
+         * @brief Renames an entry, keeping its value.
+         *
+         * @param from The current name of the entry.
+         * @param to The new name.
+         * @return `true` if the entry was renamed, `false` if `from` does not exist or `to` already exists.
+         */
+        bool rename(std::basic_string_view<CharT> from, std::basic_string_view<CharT> to)
+        {
+            const Node* node{m_next->findName(from)};
+            if (!node || m_next->findName(to))
+            {
+                return false;
+            }
+            const T value{node->value};
+            eraseName(from);
+            eraseValue(value);
+            insert(std::make_shared<const Node>(Node{value, std::basic_string<CharT>{to}}));
+            ++m_changes;
+            return true;
+        }
+
+        /**
+         * @brief Returns a view of the staged version, for lookups between changes.
+         */
+        const Snapshot& staged() const
+        {
+            return *m_next;
+        }
+
+    private:
+        friend class IncrementalEnumHolder;
+
+        explicit Editor(const Snapshot& current)
+            : m_next(std::make_shared<Snapshot>(current))
+        {
+            m_next->m_version = current.m_version + 1;
+        }
+
+        /// Returns a page, bucket or chunk that only the staged version references, copying it on first use.
+        template<typename Shared>
+        static Shared& own(std::shared_ptr<Shared>& shared)
+        {
+            // Pages, buckets and chunks inherited from the current version are also referenced by
+            // it, so a count of one means the object was already copied for this edit.
+            if (shared.use_count() != 1)
+            {
+                shared = std::make_shared<Shared>(*shared);
+            }
+            return *shared;
+        }
+
+        Bucket& ownBucket(size_t index)
+        {
+            return own(own(m_next->m_bucketPages[index / kPageSize])[index % kPageSize]);
+        }
+
+        void insert(NodePtr node)
+        {
+            if (m_next->m_size + 1 > m_next->m_bucketCount * kBucketLoad)
+            {
+                m_next->rehash(m_next->m_bucketCount * 2, m_next->m_seed);
+            }
+            Bucket& bucket{ownBucket(m_next->bucketOf(node->name))};
+            bucket.push_back(node);
+            if (bucket.size() > kMaxBucket)
+            {
+                m_next->rehash(m_next->m_bucketCount, detail::nextHashSeed());
+            }
+
+            auto& pages{m_next->m_chunkPages};
+            if (pages.empty())
+            {
+                pages.push_back(std::make_shared<Page>(1, std::make_shared<Bucket>(1, node)));
+            }
+            else
+            {
+                auto position{m_next->chunkOf(node->value)};
+                if (position.page == pages.size())
+                {
+                    position = {0, 0}; // Values below the first chunk go to the first chunk.
+                }
+                Page& page{own(pages[position.page])};
+                Bucket& chunk{own(page[position.slot])};
+                chunk.insert(std::lower_bound(chunk.begin(), chunk.end(), node->value, [](const NodePtr& other, T key) { return other->value < key; }), node);
+                if (chunk.size() >= 2 * kChunkSize)
+                {
+                    auto upper{std::make_shared<Bucket>(chunk.begin() + kChunkSize, chunk.end())};
+                    chunk.resize(kChunkSize);
+                    page.insert(page.begin() + position.slot + 1, std::move(upper));
+                }
+                if (page.size() >= 2 * kPageSize)
+                {
+                    auto upper{std::make_shared<Page>(page.begin() + kPageSize, page.end())};
+                    page.resize(kPageSize);
+                    pages.insert(pages.begin() + position.page + 1, std::move(upper));
+                }
+            }
+            ++m_next->m_size;
+        }
+
+        void eraseName(std::basic_string_view<CharT> name)
+        {
+            Bucket& bucket{ownBucket(m_next->bucketOf(name))};
+            bucket.erase(std::find_if(bucket.begin(), bucket.end(), [name](const NodePtr& node) { return node->name == name; }));
+        }
+
+        void eraseValue(T value)
+        {
+            auto& pages{m_next->m_chunkPages};
+            const auto position{m_next->chunkOf(value)};
+            Page& page{own(pages[position.page])};
+            Bucket& chunk{own(page[position.slot])};
+            chunk.erase(std::lower_bound(chunk.begin(), chunk.end(), value, [](const NodePtr& node, T key) { return node->value < key; }));
+            if (chunk.empty())
+            {
+                page.erase(page.begin() + position.slot);
+            }
+            if (page.empty())
+            {
+                pages.erase(pages.begin() + position.page);
+            }
+            --m_next->m_size;
+        }
+
+        std::shared_ptr<Snapshot> m_next; ///< The staged version.
+        size_t m_changes{0};              ///< The number of applied changes.
+    };
+
+    UNCOPYABLE(IncrementalEnumHolder)
+
+    /**
+     * @brief Builds the first version from value/name definitions.
+     *
+     * When several definitions share a name or a value, the first one wins.
+     *
+     * @param definitions The initial entries.
+     */
+    explicit IncrementalEnumHolder(const std::vector<Definition>& definitions = {})
+    {
+        auto first{std::make_shared<Snapshot>()};
+        size_t count{1};
+        while (count * kBucketLoad < definitions.size())
+        {
+            count *= 2;
+        }
+        first->rehash(count, detail::nextHashSeed());
+
+        std::vector<NodePtr> nodes;
+        nodes.reserve(definitions.size());
+        for (const auto& [value, name] : definitions)
+        {
+            if (first->findName(name))
+            {
+                continue;
+            }
+            auto node{std::make_shared<const Node>(Node{value, name})};
+            first->bucket(first->bucketOf(name))->push_back(node);
+            nodes.push_back(std::move(node));
+        }
+
+        std::stable_sort(nodes.begin(), nodes.end(), [](const NodePtr& lhs, const NodePtr& rhs) { return lhs->value < rhs->value; });
+        auto& pages{first->m_chunkPages};
+        for (size_t index{0}; index < nodes.size(); ++index)
+        {
+            if (index > 0 && nodes[index]->value == nodes[index - 1]->value)
+            {
+                // A later definition of the same value loses; drop its name again.
+                Bucket& bucket{*first->bucket(first->bucketOf(nodes[index]->name))};
+                bucket.erase(std::find(bucket.begin(), bucket.end(), nodes[index]));
+                continue;
+            }
+            if (pages.empty() || (pages.back()->back()->size() == kChunkSize && pages.back()->size() == kPageSize))
+            {
+                pages.push_back(std::make_shared<Page>());
+                pages.back()->reserve(kPageSize);
+            }
+            Page& page{*pages.back()};
+            if (page.empty() || page.back()->size() == kChunkSize)
+            {
+                page.push_back(std::make_shared<Bucket>());
+                page.back()->reserve(kChunkSize);
+            }
+            page.back()->push_back(nodes[index]);
+            ++first->m_size;
+        }
+        const auto overfull = [&first]() {
+            return std::any_of(first->m_bucketPages.begin(), first->m_bucketPages.end(), [](const PagePtr& page) {
+                return std::any_of(page->begin(), page->end(), [](const BucketPtr& bucket) { return bucket->size() > kMaxBucket; });
+            });
+        };
+        while (overfull())
+        {
+            first->rehash(first->m_bucketCount, detail::nextHashSeed());
+        }
+        m_current.exchange(std::move(first));
+    }
+
+    /**
+     * @brief Returns the current version without waiting for writers.
+     */
+    SnapshotPtr snapshot() const
+    {
+        return m_current.load();
+    }
+
+    /**
+     * @brief Applies a batch of changes and publishes them as one new version.
+     *
+     * Readers see either none or all of the changes of the batch.
+     *
+     * @param changes Called as `changes(editor)` to stage the changes.
+     * @return The number of changes applied; no version is published when it is `0`.
+     */
+    template<class Changes>
+    size_t edit(Changes&& changes)
+    {
+        std::lock_guard<std::mutex> lock{m_writer};
+        const SnapshotPtr current{m_current.load()};
+        Editor editor{*current};
+        changes(editor);
+        if (editor.m_changes > 0)
+        {
+            m_current.exchange(std::move(editor.m_next));
+        }
+        return editor.m_changes;
+    }
+
+    /**
+     * @brief Adds an entry and publishes a new version.
+     *
+     * @return `true` if the entry was added, `false` if the name or the value already exists.
+     */
+    bool add(T value, std::basic_string_view<CharT> name)
+    {
+        return edit([&](Editor& editor) { editor.add(value, name); }) > 0;
+    }
+
+    /**
+     * @brief Removes an entry and publishes a new version.
+     *
+     * @return `true` if the entry was removed, `false` if the name does not exist.
+     */
+    bool remove(std::basic_string_view<CharT> name)
+    {
+        return edit([&](Editor& editor) { editor.remove(name); }) > 0;
+    }
+
+    /**
+     * @brief Renames an entry and publishes a new version.
+     *
+     * @return `true` if the entry was renamed, `false` if `from` does not exist or `to` already exists.
+     */
+    bool rename(std::basic_string_view<CharT> from, std::basic_string_view<CharT> to)
+    {
+        return edit([&](Editor& editor) { editor.rename(from, to); }) > 0;
+    }
+
+private:
+    detail::AtomicSharedPtr<const Snapshot> m_current; ///< The published version.
+    std::mutex m_writer;                               ///< Serializes the writers.
+};
+
+} // namespace trlc
\ No newline at end of file
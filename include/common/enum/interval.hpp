@@ -0,0 +1,167 @@
+#pragma once
+#include "detail.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace trlc
+{
+
+/**
+ * @brief Maps the keys of a closed range `[low, high]` to an Enum entry, e.g. HTTP status 400-499 to `ClientError`.
+ *
+ * @tparam K The type of the keys, ordered with `<`.
+ * @tparam T The type of the enum value.
+ * @tparam CharT The character type of the name.
+ */
+template<typename K, typename T, typename CharT = char>
+struct IntervalEnum
+{
+    using char_type = CharT; ///< The character type of the name.
+
+    K low{};                ///< The first key of the range.
+    K high{};               ///< The last key of the range, included.
+    Enum<T, CharT> entry{}; ///< The entry the keys map to.
+};
+
+/**
+ * @brief Holds Enum entries that each cover a range of keys and finds the range holding a key.
+ *
+ * The ranges may be listed in any order. At construction, at compile time for a `constexpr` holder,
+ * they are sorted by their first key and checked for overlaps; `static_assert(holder.valid())` to
+ * reject overlapping or reversed ranges at compile time. A lookup is a branchless binary search over
+ * the first keys followed by one compare with the last key of the range found.
+ *
+ * @tparam K The type of the keys, ordered with `<`.
+ * @tparam T The type of the enum value.
+ * @tparam N The number of ranges.
+ * @tparam UnknownPolicy The policy for handling keys outside every range.
+ * @tparam CharT The character type of the names.
+ */
+template<typename K, typename T, size_t N, class UnknownPolicy = policy::UnknownPolicy, typename CharT = char>
+class IntervalEnumHolder
+{
+public:
+    using char_type = CharT; ///< The character type of the names.
+
+    /**
+     * @brief Creates a holder over the ranges, sorts them and checks them for overlaps.
+     *
+     * @param entries The array of ranges, which must outlive the holder.
+     */
+    constexpr IntervalEnumHolder(const std::array<IntervalEnum<K, T, CharT>, N>& entries)
+        : m_entries(entries)
+    {
+        for (size_t index{0}; index < N; ++index)
+        {
+            m_order[index] = index;
+        }
+        // Insertion sort: the tables are small and this also runs during constant evaluation.
+        for (size_t index{1}; index < N; ++index)
+        {
+            const size_t slot{m_order[index]};
+            size_t position{index};
+            for (; position > 0 && entries[slot].low < entries[m_order[position - 1]].low; --position)
+            {
+                m_order[position] = m_order[position - 1];
+            }
+            m_order[position] = slot;
+        }
+
+        m_valid = true;
+        for (size_t position{0}; position < N; ++position)
+        {
+            m_lows[position] = entries[m_order[position]].low;
+            m_highs[position] = entries[m_order[position]].high;
+            m_valid = m_valid && !(m_highs[position] < m_lows[position]) && (position == 0 || m_highs[position - 1] < m_lows[position]);
+        }
+    }
+
+    /**
+     * @brief Returns whether every range is non-empty and no two ranges overlap; `static_assert` it on a `constexpr` holder.
+     */
+    constexpr bool valid() const
+    {
+        return m_valid;
+    }
+
+    /**
+     * @brief Retrieves the Enum entry of the range holding a key.
+     *
+     * @param key The key to search for.
+     * @return The entry of the range, or the unknown policy's result if no range holds the key.
+     */
+    constexpr Enum<T, CharT> fromValue(K key) const
+    {
+        const size_t index{indexFromValue(key)};
+        if (index < N)
+        {
+            return m_entries[index].entry;
+        }
+        if constexpr (std::is_integral_v<K> || std::is_enum_v<K>)
+        {
+            return UnknownPolicy::template handle<T>(static_cast<T>(key), m_entries);
+        }
+        else
+        {
+            return UnknownPolicy::template handle<T>(T{}, m_entries);
+        }
+    }
+
+    /**
+     * @brief Returns the slot of the range holding a key, for indexing per-entry data such as an `EnumSet`.
+     *
+     * The unknown policy is not consulted.
+     *
+     * @param key The key to search for.
+     * @return The slot of the range in the entries, or `N` if no range holds the key.
+     */
+    constexpr size_t indexFromValue(K key) const
+    {
+        if constexpr (N == 0)
+        {
+            return N;
+        }
+        else
+        {
+            // Halve the candidates with a conditional move instead of a branch: `base` ends on the
+            // last first key not above `key`, if there is one.
+            size_t base{0};
+            for (size_t length{N}; length > 1; length -= length / 2)
+            {
+                base = !(key < m_lows[base + length / 2]) ? base + length / 2 : base;
+            }
+            const bool within{!(key < m_lows[base]) && !(m_highs[base] < key)};
+            return within ? m_order[base] : N;
+        }
+    }
+
+    /**
+     * @brief Returns the number of ranges.
+     */
+    static constexpr size_t size()
+    {
+        return N;
+    }
+
+    /**
+     * @brief Retrieves all ranges in their given order.
+     *
+     * @return An array of all ranges.
+     */
+    constexpr const std::array<IntervalEnum<K, T, CharT>, N>& allValues() const
+    {
+        return m_entries;
+    }
+
+    const std::array<IntervalEnum<K, T, CharT>, N>& m_entries; ///< The array of ranges.
+
+private:
+    std::array<K, N> m_lows{};       ///< The first key of each range, in key order.
+    std::array<K, N> m_highs{};      ///< The last key of each range, in key order.
+    std::array<size_t, N> m_order{}; ///< The slot in the entries of each range, in key order.
+    bool m_valid{false};             ///< Whether the ranges are non-empty and disjoint.
+};
+
+} // namespace trlc
\ No newline at end of file
@@ -0,0 +1,605 @@
+#pragma once
+#if !defined(__linux__)
+#error "StreamingEnumLoader requires Linux"
+#endif
+
+#include "incremental.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+// `IORING_OP_READ` is an enumerator; `IORING_FEAT_RW_CUR_POS` arrived with it in Linux 5.6.
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define TRLC_ENUM_HAS_IO_URING
+#endif
+
+namespace trlc
+{
+
+namespace detail
+{
+#if defined(TRLC_ENUM_HAS_IO_URING)
+/**
+ * @brief A minimal io_uring for file reads, set up through the raw system calls (no liburing).
+ *
+ * Used by one thread; `valid()` is `false` when the kernel refuses the ring.
+ */
+class IoUring
+{
+public:
+    UNCOPYABLE(IoUring)
+
+    /**
+     * @brief Sets up a ring.
+     *
+     * @param entries The number of submission entries, a power of two.
+     */
+    explicit IoUring(unsigned entries)
+    {
+        io_uring_params params{};
+        m_fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (m_fd < 0)
+        {
+            return;
+        }
+
+        const bool single{(params.features & IORING_FEAT_SINGLE_MMAP) != 0};
+        m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (single)
+        {
+            m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+        }
+        m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+        m_cqRing = single ? m_sqRing : mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_CQ_RING);
+        void* sqes{mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES)};
+        m_sqes = sqes == MAP_FAILED ? nullptr : static_cast<io_uring_sqe*>(sqes);
+        if (m_sqRing == MAP_FAILED || m_cqRing == MAP_FAILED || !m_sqes)
+        {
+            release();
+            return;
+        }
+
+        auto* sq{static_cast<char*>(m_sqRing)};
+        m_sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        m_sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        m_sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        m_sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        auto* cq{static_cast<char*>(m_cqRing)};
+        m_cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        m_cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        m_cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        m_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+
+    ~IoUring()
+    {
+        release();
+    }
+
+    /**
+     * @brief Returns whether the ring is set up.
+     */
+    bool valid() const
+    {
+        return m_fd >= 0;
+    }
+
+    /**
+     * @brief Submits a read of `length` bytes at `offset` of a file.
+     *
+     * @return `true` if the kernel accepted the read; its completion carries `tag`.
+     */
+    bool submitRead(int fd, void* buffer, uint32_t length, uint64_t offset, uint64_t tag)
+    {
+        const unsigned tail{*m_sqTail};
+        if (tail - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE) > m_sqMask)
+        {
+            return false;
+        }
+        const unsigned index{tail & m_sqMask};
+        io_uring_sqe& sqe{m_sqes[index]};
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<uint64_t>(buffer);
+        sqe.len = length;
+        sqe.off = offset;
+        sqe.user_data = tag;
+        m_sqArray[index] = index;
+        __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+
+        long submitted{0};
+        do
+        {
+            submitted = syscall(__NR_io_uring_enter, m_fd, 1, 0, 0, nullptr, 0);
+        } while (submitted < 0 && errno == EINTR);
+        return submitted == 1;
+    }
+
+    /**
+     * @brief Waits for the next completion.
+     *
+     * @param tag Receives the tag of the completed read.
+     * @param result Receives the bytes read, or a negated `errno`.
+     * @return `false` if the ring failed.
+     */
+    bool waitCompletion(uint64_t& tag, int& result)
+    {
+        const unsigned head{*m_cqHead};
+        while (head == __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE))
+        {
+            if (syscall(__NR_io_uring_enter, m_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR)
+            {
+                return false;
+            }
+        }
+        const io_uring_cqe& cqe{m_cqes[head & m_cqMask]};
+        tag = cqe.user_data;
+        result = cqe.res;
+        __atomic_store_n(m_cqHead, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+private:
+    void release()
+    {
+        if (m_sqes)
+        {
+            munmap(m_sqes, m_sqesSize);
+        }
+        if (m_cqRing != MAP_FAILED && m_cqRing != m_sqRing)
+        {
+            munmap(m_cqRing, m_cqRingSize);
+        }
+        if (m_sqRing != MAP_FAILED)
+        {
+            munmap(m_sqRing, m_sqRingSize);
+        }
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+        }
+        m_sqes = nullptr;
+        m_sqRing = m_cqRing = MAP_FAILED;
+        m_fd = -1;
+    }
+
+    int m_fd{-1};                  ///< The ring file descriptor.
+    void* m_sqRing{MAP_FAILED};    ///< The mapped submission ring.
+    void* m_cqRing{MAP_FAILED};    ///< The mapped completion ring; the submission ring with `IORING_FEAT_SINGLE_MMAP`.
+    io_uring_sqe* m_sqes{nullptr}; ///< The mapped submission entries.
+    size_t m_sqRingSize{0};        ///< The size of the submission ring mapping.
+    size_t m_cqRingSize{0};        ///< The size of the completion ring mapping.
+    size_t m_sqesSize{0};          ///< The size of the submission entries mapping.
+    unsigned* m_sqHead{nullptr};   ///< The submission head, advanced by the kernel.
+    unsigned* m_sqTail{nullptr};   ///< The submission tail, advanced by this thread.
+    unsigned* m_sqArray{nullptr};  ///< The submission index array.
+    unsigned m_sqMask{0};          ///< The submission ring mask.
+    unsigned* m_cqHead{nullptr};   ///< The completion head, advanced by this thread.
+    unsigned* m_cqTail{nullptr};   ///< The completion tail, advanced by the kernel.
+    io_uring_cqe* m_cqes{nullptr}; ///< The completion entries.
+    unsigned m_cqMask{0};          ///< The completion ring mask.
+};
+#endif
+
+template<class Policy, typename T, typename Key, class Entries, typename = void>
+struct HasPendingHandler : std::false_type
+{
+};
+
+template<class Policy, typename T, typename Key, class Entries>
+struct HasPendingHandler<Policy, T, Key, Entries, std::void_t<decltype(Policy::template handlePending<T>(std::declval<Key>(), std::declval<const Entries&>()))>> : std::true_type
+{
+};
+
+/**
+ * @brief Handles a lookup that missed while entries are still loading.
+ *
+ * Calls `Policy::handlePending<T>(key, entries)` if the policy has it, otherwise `Policy::handle<T>`.
+ */
+template<class Policy, typename T, typename Key, class Entries>
+Enum<T, char> handlePending(Key key, const Entries& entries)
+{
+    if constexpr (HasPendingHandler<Policy, T, Key, Entries>::value)
+    {
+        return Policy::template handlePending<T>(key, entries);
+    }
+    else
+    {
+        return Policy::template handle<T>(key, entries);
+    }
+}
+} // namespace detail
+
+/**
+ * @brief The progress of a `StreamingEnumLoader`.
+ */
+enum class EnumLoadState : uint8_t
+{
+    Loading, ///< Entries are still being read; lookups see those loaded so far.
+    Loaded,  ///< Every entry of the file is published.
+    Failed   ///< The file was unreadable or malformed; the entries before the failure stay published.
+};
+
+/**
+ * @brief Counters published by a `StreamingEnumLoader`.
+ */
+struct EnumLoaderMetrics
+{
+    std::atomic<uint64_t> bytesRead{0}; ///< Bytes of the file read so far.
+    std::atomic<uint64_t> entries{0};   ///< Entries published so far.
+    std::atomic<uint64_t> batches{0};   ///< Versions published so far.
+    std::atomic<bool> ioUring{false};   ///< Whether the file is read through io_uring rather than `pread`.
+};
+
+/**
+ * @brief Loads a large dictionary file of `Name = Value` lines in the background, making its entries queryable as they arrive.
+ *
+ * A loader thread reads the file in chunks through io_uring, keeping the read of the next chunk in
+ * flight while it parses the current one, and falls back to `pread` when io_uring is unavailable.
+ * Parsed entries are published into an `IncrementalEnumHolder` in batches that grow with the
+ * holder, so republishing stays linear in the file size. When several lines share a name or a
+ * value, the first one wins.
+ *
+ * A lookup that misses while the state is `Loading` goes through `UnknownPolicy::handlePending<T>`
+ * when the policy defines it (same signatures as `handle`), so callers can tell "not yet loaded"
+ * from "unknown"; otherwise it goes through `handle` like any miss. Entries are only ever added, so
+ * names returned by lookups stay valid as long as the loader is alive.
+ *
+ * An optional progress callback runs on the loader thread after each published version, with the
+ * metrics so far; the load resumes when it returns.
+ *
+ * @tparam T The type of the enum value.
+ * @tparam UnknownPolicy The policy for handling unknown and not yet loaded enums.
+ */
+template<typename T, class UnknownPolicy = policy::UnknownPolicy>
+class StreamingEnumLoader
+{
+public:
+    using Holder = IncrementalEnumHolder<T, UnknownPolicy>;
+    using SnapshotPtr = typename Holder::SnapshotPtr;
+    using Progress = std::function<void(const EnumLoaderMetrics&)>;
+
+    static constexpr size_t kDefaultChunkSize{size_t{1} << 20}; ///< Bytes per read.
+    static constexpr size_t kMinBatch{4096};                    ///< Entries per published version at least.
+    static constexpr size_t kBatchDivisor{8};                   ///< Later versions add one eighth of the entries published so far.
+
+    UNCOPYABLE(StreamingEnumLoader)
+
+    /**
+     * @brief Starts loading a dictionary file.
+     *
+     * @param path The path of the dictionary file.
+     * @param chunkSize The bytes per read.
+     * @param ioUring Whether to try io_uring before `pread`.
+     * @param progress Called on the loader thread after each published version.
+     */
+    explicit StreamingEnumLoader(std::string path, size_t chunkSize = kDefaultChunkSize, bool ioUring = true, Progress progress = {})
+        : m_path(std::move(path))
+        , m_chunkSize(std::clamp<size_t>(chunkSize, 1, size_t{1} << 30))
+        , m_progress(std::move(progress))
+    {
+        m_thread = std::thread([this, ioUring]() { load(ioUring); });
+    }
+
+    ~StreamingEnumLoader()
+    {
+        m_stop.store(true, std::memory_order_relaxed);
+        m_thread.join();
+    }
+
+    /**
+     * @brief Returns the progress of the load.
+     */
+    EnumLoadState state() const
+    {
+        return m_state.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Blocks until the load has finished.
+     *
+     * @return `EnumLoadState::Loaded` or `EnumLoadState::Failed`.
+     */
+    EnumLoadState wait() const
+    {
+        std::unique_lock<std::mutex> lock{m_doneMutex};
+        m_done.wait(lock, [this]() { return state() != EnumLoadState::Loading; });
+        return state();
+    }
+
+    /**
+     * @brief Returns the entries loaded so far without waiting for the loader.
+     */
+    SnapshotPtr snapshot() const
+    {
+        return m_holder.snapshot();
+    }
+
+    /**
+     * @brief Retrieves an Enum entry from a value.
+     *
+     * @param value The enum value to search for.
+     * @return The corresponding Enum entry, or the unknown policy's result if it is not loaded (yet).
+     */
+    Enum<T, char> fromValue(T value) const
+    {
+        // Read the state before the snapshot: once loading has finished, the snapshot is final.
+        const bool loading{state() == EnumLoadState::Loading};
+        const SnapshotPtr current{m_holder.snapshot()};
+        if (loading && !current->contains(value))
+        {
+            return detail::handlePending<UnknownPolicy, T>(value, *current);
+        }
+        return current->fromValue(value);
+    }
+
+    /**
+     * @brief Retrieves an Enum entry from a string name.
+     *
+     * @param name The name to search for.
+     * @return The corresponding Enum entry, or the unknown policy's result if it is not loaded (yet).
+     */
+    Enum<T, char> fromString(std::string_view name) const
+    {
+        const bool loading{state() == EnumLoadState::Loading};
+        const SnapshotPtr current{m_holder.snapshot()};
+        if (loading && !current->contains(name))
+        {
+            return detail::handlePending<UnknownPolicy, T>(name, *current);
+        }
+        return current->fromString(name);
+    }
+
+    /**
+     * @brief Returns the load metrics.
+     */
+    const EnumLoaderMetrics& metrics() const
+    {
+        return m_metrics;
+    }
+
+private:
+    static constexpr unsigned kDepth{2}; ///< Chunks in flight: one being parsed, one being read.
+
+    void load(bool ioUring)
+    {
+        bool ok{false};
+        const int fd{open(m_path.c_str(), O_RDONLY | O_CLOEXEC)};
+        if (fd >= 0)
+        {
+            struct stat status{};
+            ok = fstat(fd, &status) == 0 && readChunks(fd, static_cast<uint64_t>(status.st_size), ioUring);
+            close(fd);
+        }
+        // A last line without a newline is still an entry.
+        ok = ok && (m_carry.empty() || parseLine(m_carry));
+        publish();
+
+        {
+            std::lock_guard<std::mutex> lock{m_doneMutex};
+            m_state.store(ok && !m_stop.load(std::memory_order_relaxed) ? EnumLoadState::Loaded : EnumLoadState::Failed, std::memory_order_release);
+        }
+        m_done.notify_all();
+    }
+
+    bool readChunks(int fd, uint64_t size, bool ioUring)
+    {
+        const uint64_t chunks{(size + m_chunkSize - 1) / m_chunkSize};
+        std::array<std::vector<char>, kDepth> buffers;
+        std::array<int, kDepth> results{};
+        std::array<bool, kDepth> done{};
+        size_t inFlight{0};
+
+#if defined(TRLC_ENUM_HAS_IO_URING)
+        std::unique_ptr<detail::IoUring> ring{ioUring ? std::make_unique<detail::IoUring>(kDepth) : nullptr};
+        bool useRing{ring && ring->valid()};
+#else
+        static_cast<void>(ioUring);
+        bool useRing{false};
+#endif
+        m_metrics.ioUring.store(useRing, std::memory_order_relaxed);
+
+        const auto chunkLength = [this, size](uint64_t chunk) { return static_cast<size_t>(std::min<uint64_t>(m_chunkSize, size - chunk * m_chunkSize)); };
+        const auto submit = [&](uint64_t chunk) {
+            const size_t slot{chunk % kDepth};
+            buffers[slot].resize(chunkLength(chunk));
+            done[slot] = false;
+#if defined(TRLC_ENUM_HAS_IO_URING)
+            if (useRing && ring->submitRead(fd, buffers[slot].data(), static_cast<uint32_t>(buffers[slot].size()), chunk * m_chunkSize, slot))
+            {
+                ++inFlight;
+                return;
+            }
+#endif
+            // Without a ring the chunk is read with `pread` when its turn comes.
+            useRing = false;
+            results[slot] = -1;
+            done[slot] = true;
+        };
+
+        for (uint64_t chunk{0}; chunk < std::min<uint64_t>(kDepth, chunks); ++chunk)
+        {
+            submit(chunk);
+        }
+
+        bool ok{true};
+        for (uint64_t chunk{0}; chunk < chunks && ok && !m_stop.load(std::memory_order_relaxed); ++chunk)
+        {
+            const size_t slot{chunk % kDepth};
+#if defined(TRLC_ENUM_HAS_IO_URING)
+            while (ok && !done[slot])
+            {
+                uint64_t tag{0};
+                int result{0};
+                ok = ring->waitCompletion(tag, result);
+                if (ok)
+                {
+                    --inFlight;
+                    results[tag] = result;
+                    done[tag] = true;
+                }
+            }
+            if (!ok)
+            {
+                break; // Drain the other reads below before the buffers go away.
+            }
+#endif
+            // Complete short or failed reads (e.g. a kernel without IORING_OP_READ) with `pread`.
+            std::vector<char>& buffer{buffers[slot]};
+            size_t length{results[slot] > 0 ? static_cast<size_t>(results[slot]) : 0};
+            while (length < buffer.size())
+            {
+                const ssize_t read{pread(fd, buffer.data() + length, buffer.size() - length, static_cast<off_t>(chunk * m_chunkSize + length))};
+                if (read < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                if (read <= 0)
+                {
+                    ok = read == 0;
+                    break;
+                }
+                length += static_cast<size_t>(read);
+            }
+            m_metrics.bytesRead.fetch_add(length, std::memory_order_relaxed);
+
+            ok = ok && parseChunk(std::string_view{buffer.data(), length});
+            if (length < buffer.size())
+            {
+                break; // The file shrank while loading.
+            }
+            if (chunk + kDepth < chunks)
+            {
+                submit(chunk + kDepth);
+            }
+        }
+
+#if defined(TRLC_ENUM_HAS_IO_URING)
+        // The kernel may still write into the buffers until their reads complete.
+        uint64_t tag{0};
+        int result{0};
+        while (inFlight > 0 && ring->waitCompletion(tag, result))
+        {
+            --inFlight;
+        }
+        if (inFlight > 0)
+        {
+            // The ring failed with reads pending: leak it and the buffers rather than free them under the kernel.
+            static_cast<void>(ring.release());
+            static_cast<void>(new std::array<std::vector<char>, kDepth>(std::move(buffers)));
+            return false;
+        }
+#endif
+        return ok;
+    }
+
+    bool parseChunk(std::string_view data)
+    {
+        for (size_t newline{data.find('\n')}; newline != std::string_view::npos; newline = data.find('\n'))
+        {
+            const std::string_view line{data.substr(0, newline)};
+            data.remove_prefix(newline + 1);
+            if (m_carry.empty())
+            {
+                if (!parseLine(line))
+                {
+                    return false;
+                }
+                continue;
+            }
+            // The line started in the previous chunk.
+            m_carry.append(line);
+            const bool parsed{parseLine(m_carry)};
+            m_carry.clear();
+            if (!parsed)
+            {
+                return false;
+            }
+        }
+        m_carry.append(data);
+        return true;
+    }
+
+    bool parseLine(std::string_view line)
+    {
+        std::string_view name;
+        T value{};
+        bool hasEntry{false};
+        if (!detail::parseDictionaryLine(line, name, value, hasEntry))
+        {
+            return false;
+        }
+        if (hasEntry)
+        {
+            m_batch.emplace_back(value, std::string{name});
+            if (m_batch.size() >= std::max(kMinBatch, m_loaded / kBatchDivisor))
+            {
+                publish();
+            }
+        }
+        return true;
+    }
+
+    void publish()
+    {
+        if (m_batch.empty())
+        {
+            return;
+        }
+        m_loaded += m_holder.edit([this](typename Holder::Editor& editor) {
+            for (const auto& [value, name] : m_batch)
+            {
+                editor.add(value, name);
+            }
+        });
+        m_batch.clear();
+        m_metrics.entries.store(m_loaded, std::memory_order_relaxed);
+        m_metrics.batches.fetch_add(1, std::memory_order_relaxed);
+        if (m_progress)
+        {
+            m_progress(m_metrics);
+        }
+    }
+
+    std::string m_path;                                         ///< The dictionary file.
+    size_t m_chunkSize;                                         ///< Bytes per read.
+    Progress m_progress;                                        ///< Called after each published version.
+    Holder m_holder;                                            ///< The entries loaded so far.
+    std::atomic<EnumLoadState> m_state{EnumLoadState::Loading}; ///< The progress of the load.
+    std::atomic<bool> m_stop{false};                            ///< Asks the loader thread to stop early.
+    mutable std::mutex m_doneMutex;                             ///< Guards the end of the load for `wait`.
+    mutable std::condition_variable m_done;                     ///< Signals the end of the load.
+    EnumLoaderMetrics m_metrics;                                ///< Load metrics.
+    std::string m_carry;                                        ///< The start of a line cut by the end of a chunk.
+    std::vector<typename Holder::Definition> m_batch;           ///< Parsed entries not published yet.
+    size_t m_loaded{0};                                         ///< Entries published so far.
+    std::thread m_thread;                                       ///< The loader thread.
+};
+
+} // namespace trlc
\ No newline at end of file
@@ -0,0 +1,430 @@
+#pragma once
+#include "detail.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace trlc
+{
+
+/**
+ * @brief Matches the keys with `(key & mask) == pattern` to an Enum entry, e.g. an instruction encoding.
+ *
+ * @tparam K The type of the keys, an unsigned integer.
+ * @tparam T The type of the enum value.
+ * @tparam CharT The character type of the name.
+ */
+template<typename K, typename T, typename CharT = char>
+struct MaskedEnum
+{
+    using char_type = CharT; ///< The character type of the name.
+
+    K mask{};               ///< The bits of the key the entry looks at.
+    K pattern{};            ///< The expected value of those bits.
+    Enum<T, CharT> entry{}; ///< The entry the matching keys map to.
+};
+
+/**
+ * @brief Holds Enum entries that each match a mask and pattern, and finds the first entry matching a key.
+ *
+ * Entries are tried in table order, so list specific encodings before the general ones they
+ * refine. At construction, at compile time for a `constexpr` holder, `Bits` discriminating bit
+ * positions are chosen greedily to spread the entries over the `2^Bits` cells of a decision table,
+ * and every cell keeps the few entries whose pattern agrees with the cell on those bits. A cell left
+ * with more than `kCellSlots` candidates becomes a branch on one more key bit, chosen the same way,
+ * and so on until every leaf holds at most `kCellSlots` candidates. Candidates after one whose mask
+ * is fully decided by the bits tested so far can never win and are dropped, so general entries that
+ * land everywhere, such as a catch-all, do not keep a leaf from shrinking. A lookup gathers the bits
+ * of the key (one `pext` with BMI2), follows the branches of its cell, then tests the candidates of
+ * the leaf, so it takes a few steps however many entries there are.
+ *
+ * The branches come from a pool of `kNodes`; if it runs out, the remaining large nodes try every
+ * entry instead, and `scanNodes()` counts them.
+ *
+ * @tparam K The type of the keys, an unsigned integer.
+ * @tparam T The type of the enum value.
+ * @tparam N The number of entries.
+ * @tparam UnknownPolicy The policy for handling keys no entry matches.
+ * @tparam CharT The character type of the names.
+ * @tparam Bits The number of discriminating bits; the table has `2^Bits` cells.
+ */
+template<typename K, typename T, size_t N, class UnknownPolicy = policy::UnknownPolicy, typename CharT = char, size_t Bits = 8>
+class MaskedEnumHolder
+{
+    static_assert(std::is_unsigned_v<K>, "MaskedEnumHolder keys must be unsigned integers");
+    static_assert(Bits > 0 && Bits <= sizeof(K) * 8 && Bits <= 16, "MaskedEnumHolder needs between 1 and 16 discriminating bits that fit in the key");
+    static_assert(N < UINT16_MAX, "MaskedEnumHolder supports fewer than 65535 entries");
+
+public:
+    using char_type = CharT; ///< The character type of the names.
+
+    static constexpr size_t kCells{size_t{1} << Bits}; ///< The number of cells of the decision table.
+    static constexpr size_t kCellSlots{4};             ///< The candidates kept per leaf.
+    static constexpr size_t kNodes{4 * N + 16};        ///< The nodes available to branch below the cells.
+
+    /**
+     * @brief Creates a holder over the entries and builds the decision table.
+     *
+     * @param entries The array of entries, which must outlive the holder.
+     */
+    constexpr MaskedEnumHolder(const std::array<MaskedEnum<K, T, CharT>, N>& entries)
+        : m_entries(entries)
+    {
+        chooseBits();
+        for (size_t index{0}; index < N; ++index)
+        {
+            const size_t mask{gather(entries[index].mask)};
+            forEachCell(mask, gather(entries[index].pattern) & mask, kCells, [this, index](size_t cell) {
+                Node& node{m_cells[cell]};
+                if (node.count < kCellSlots)
+                {
+                    node.slots[node.count] = static_cast<uint16_t>(index);
+                }
+                node.count = static_cast<uint16_t>(node.count + 1);
+            });
+        }
+
+        // Split the cells that overflowed on further bits.
+        for (size_t cell{0}; cell < kCells; ++cell)
+        {
+            if (m_cells[cell].count <= kCellSlots)
+            {
+                continue;
+            }
+            K values{0};
+            for (size_t bit{0}; bit < Bits; ++bit)
+            {
+                values |= static_cast<K>(static_cast<K>((cell >> bit) & 1) << m_bits[bit]);
+            }
+            std::array<uint16_t, N> candidates{};
+            size_t count{0};
+            for (size_t index{0}; index < N; ++index)
+            {
+                if (((entries[index].pattern ^ values) & entries[index].mask & static_cast<K>(m_select)) == 0)
+                {
+                    candidates[count++] = static_cast<uint16_t>(index);
+                }
+            }
+            build(m_cells[cell], candidates, count, static_cast<K>(m_select), values);
+        }
+    }
+
+    /**
+     * @brief Returns whether every pattern lies within its mask; an entry with a pattern bit outside its mask never matches.
+     */
+    constexpr bool valid() const
+    {
+        for (const auto& entry : m_entries)
+        {
+            if ((entry.pattern & static_cast<K>(~entry.mask)) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Retrieves the first Enum entry matching a key.
+     *
+     * @param key The key to match.
+     * @return The matching entry, or the unknown policy's result if no entry matches.
+     */
+    constexpr Enum<T, CharT> fromValue(K key) const
+    {
+        const size_t index{indexFromValue(key)};
+        if (index < N)
+        {
+            return m_entries[index].entry;
+        }
+        return UnknownPolicy::template handle<T>(static_cast<T>(key), m_entries);
+    }
+
+    /**
+     * @brief Returns the slot of the first entry matching a key, for indexing per-entry data such as an `EnumSet`.
+     *
+     * The unknown policy is not consulted.
+     *
+     * @param key The key to match.
+     * @return The slot of the entry, or `N` if no entry matches.
+     */
+    constexpr size_t indexFromValue(K key) const
+    {
+        const Node* node{&m_cells[cellOf(key)]};
+        while (node->count == kBranch)
+        {
+            node = &m_nodes[node->slots[(key >> node->bit) & 1]];
+        }
+        if (node->count <= kCellSlots)
+        {
+            for (size_t slot{0}; slot < node->count; ++slot)
+            {
+                const auto& entry{m_entries[node->slots[slot]]};
+                if ((key & entry.mask) == entry.pattern)
+                {
+                    return node->slots[slot];
+                }
+            }
+            return N;
+        }
+        for (size_t index{0}; index < N; ++index)
+        {
+            if ((key & m_entries[index].mask) == m_entries[index].pattern)
+            {
+                return index;
+            }
+        }
+        return N;
+    }
+
+    /**
+     * @brief Returns the number of cells and branches that try every entry because the node pool ran out; normally 0.
+     */
+    constexpr size_t scanNodes() const
+    {
+        size_t count{0};
+        for (const Node& node : m_cells)
+        {
+            count += node.count == kScan;
+        }
+        for (size_t index{0}; index < m_nodeCount; ++index)
+        {
+            count += m_nodes[index].count == kScan;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of entries.
+     */
+    static constexpr size_t size()
+    {
+        return N;
+    }
+
+    /**
+     * @brief Retrieves all entries.
+     *
+     * @return An array of all entries.
+     */
+    constexpr const std::array<MaskedEnum<K, T, CharT>, N>& allValues() const
+    {
+        return m_entries;
+    }
+
+    const std::array<MaskedEnum<K, T, CharT>, N>& m_entries; ///< The array of entries.
+
+private:
+    static constexpr size_t kKeyBits{sizeof(K) * 8};
+    static constexpr uint16_t kScan{kCellSlots + 1}; ///< The count of a node that tries every entry.
+    static constexpr uint16_t kBranch{UINT16_MAX};   ///< The count of a node that branches on `bit`.
+
+    /**
+     * @brief A cell or branch of the decision table.
+     */
+    struct Node
+    {
+        std::array<uint16_t, kCellSlots> slots{}; ///< The candidates in table order, or the nodes for a 0 and a 1 `bit` of a branch.
+        uint16_t count{0};                        ///< The number of candidates, `kScan` or `kBranch`.
+        uint8_t bit{0};                           ///< The key bit a branch tests.
+    };
+
+    /**
+     * @brief Fills a node from its candidates, branching while more than `kCellSlots` of them can win.
+     *
+     * @param node The node to fill.
+     * @param candidates The entries agreeing with `values` on the `decided` bits, in table order.
+     * @param count The number of candidates.
+     * @param decided The key bits tested on the way to the node.
+     * @param values The values of those bits.
+     */
+    constexpr void build(Node& node, const std::array<uint16_t, N>& candidates, size_t count, K decided, K values)
+    {
+        // An entry whose mask is decided matches every key reaching the node; the ones after it never win.
+        for (size_t slot{0}; slot < count; ++slot)
+        {
+            if ((m_entries[candidates[slot]].mask & static_cast<K>(~decided)) == 0)
+            {
+                count = slot + 1;
+            }
+        }
+        if (count <= kCellSlots)
+        {
+            for (size_t slot{0}; slot < count; ++slot)
+            {
+                node.slots[slot] = candidates[slot];
+            }
+            node.count = static_cast<uint16_t>(count);
+            return;
+        }
+        if (m_nodeCount + 2 > kNodes)
+        {
+            node.count = kScan;
+            return;
+        }
+
+        // Some candidate looks at an undecided bit, or the first one would have cut the list to one.
+        size_t bestBit{0};
+        size_t bestCost{SIZE_MAX};
+        for (size_t bit{0}; bit < kKeyBits; ++bit)
+        {
+            if ((decided >> bit) & 1)
+            {
+                continue;
+            }
+            std::array<size_t, 2> loads{};
+            for (size_t slot{0}; slot < count; ++slot)
+            {
+                const auto& entry{m_entries[candidates[slot]]};
+                if ((entry.mask >> bit) & 1)
+                {
+                    ++loads[(entry.pattern >> bit) & 1];
+                }
+                else
+                {
+                    ++loads[0];
+                    ++loads[1];
+                }
+            }
+            const size_t cost{loads[0] * loads[0] + loads[1] * loads[1]};
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestBit = bit;
+            }
+        }
+
+        node.count = kBranch;
+        node.bit = static_cast<uint8_t>(bestBit);
+        node.slots[0] = static_cast<uint16_t>(m_nodeCount);
+        node.slots[1] = static_cast<uint16_t>(m_nodeCount + 1);
+        m_nodeCount += 2;
+        for (size_t side{0}; side < 2; ++side)
+        {
+            std::array<uint16_t, N> branch{};
+            size_t branchCount{0};
+            for (size_t slot{0}; slot < count; ++slot)
+            {
+                const auto& entry{m_entries[candidates[slot]]};
+                if (((entry.mask >> bestBit) & 1) == 0 || ((entry.pattern >> bestBit) & 1) == side)
+                {
+                    branch[branchCount++] = candidates[slot];
+                }
+            }
+            const K bit{static_cast<K>(K{1} << bestBit)};
+            build(m_nodes[node.slots[side]], branch, branchCount, static_cast<K>(decided | bit), static_cast<K>(values | (side != 0 ? bit : K{0})));
+        }
+    }
+
+    /// Gathers the bits of a word at the chosen positions into the low bits of a cell.
+    constexpr size_t gather(K word) const
+    {
+        size_t cell{0};
+        for (size_t bit{0}; bit < Bits; ++bit)
+        {
+            cell |= static_cast<size_t>((word >> m_bits[bit]) & 1) << bit;
+        }
+        return cell;
+    }
+
+    constexpr size_t cellOf(K key) const
+    {
+#if defined(__BMI2__)
+        if (!detail::isConstantEvaluated())
+        {
+            return static_cast<size_t>(_pext_u64(static_cast<uint64_t>(key), m_select));
+        }
+#endif
+        return gather(key);
+    }
+
+    /// Calls `visit(cell)` for each of the first `cells` cells an entry with a gathered mask and pattern can match.
+    template<class Visit>
+    static constexpr void forEachCell(size_t mask, size_t pattern, size_t cells, Visit&& visit)
+    {
+        // Walk the subsets of the bits the entry does not mask; each one is a cell it agrees with.
+        const size_t free{(cells - 1) & ~mask};
+        for (size_t subset{free};; subset = (subset - 1) & free)
+        {
+            visit(pattern | subset);
+            if (subset == 0)
+            {
+                break;
+            }
+        }
+    }
+
+    /// Picks each next bit to minimize the sum of squared cell sizes, i.e. the expected number of candidates.
+    constexpr void chooseBits()
+    {
+        std::array<bool, kKeyBits> taken{};
+        std::array<size_t, N> masks{};    // The masks of the entries gathered over the bits chosen so far.
+        std::array<size_t, N> patterns{}; // The patterns of the entries gathered likewise, within the masks.
+        for (size_t count{0}; count < Bits; ++count)
+        {
+            const size_t cells{size_t{1} << (count + 1)};
+            size_t bestBit{0};
+            size_t bestCost{SIZE_MAX};
+            for (size_t bit{0}; bit < kKeyBits; ++bit)
+            {
+                if (taken[bit])
+                {
+                    continue;
+                }
+                std::array<size_t, kCells> loads{};
+                for (size_t index{0}; index < N; ++index)
+                {
+                    const size_t mask{masks[index] | static_cast<size_t>((m_entries[index].mask >> bit) & 1) << count};
+                    const size_t pattern{(patterns[index] | static_cast<size_t>((m_entries[index].pattern >> bit) & 1) << count) & mask};
+                    forEachCell(mask, pattern, cells, [&loads](size_t cell) { ++loads[cell]; });
+                }
+                size_t cost{0};
+                for (size_t cell{0}; cell < cells; ++cell)
+                {
+                    cost += loads[cell] * loads[cell];
+                }
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestBit = bit;
+                }
+            }
+            m_bits[count] = static_cast<uint8_t>(bestBit);
+            taken[bestBit] = true;
+            for (size_t index{0}; index < N; ++index)
+            {
+                masks[index] |= static_cast<size_t>((m_entries[index].mask >> bestBit) & 1) << count;
+                patterns[index] |= static_cast<size_t>((m_entries[index].pattern >> bestBit) & 1) << count & masks[index];
+            }
+        }
+
+        // Ascending positions let `pext` gather the cell in the same bit order.
+        for (size_t index{1}; index < Bits; ++index)
+        {
+            for (size_t position{index}; position > 0 && m_bits[position] < m_bits[position - 1]; --position)
+            {
+                const uint8_t bit{m_bits[position]};
+                m_bits[position] = m_bits[position - 1];
+                m_bits[position - 1] = bit;
+            }
+        }
+        for (const uint8_t bit : m_bits)
+        {
+            m_select |= uint64_t{1} << bit;
+        }
+    }
+
+    std::array<uint8_t, Bits> m_bits{}; ///< The discriminating bit positions, ascending.
+    uint64_t m_select{0};               ///< The discriminating bits as a mask.
+    std::array<Node, kCells> m_cells{}; ///< The cells, indexed by the gathered key bits.
+    std::array<Node, kNodes> m_nodes{}; ///< The branches and leaves below the cells.
+    size_t m_nodeCount{0};              ///< The nodes used so far.
+};
+
+} // namespace trlc
\ No newline at end of file
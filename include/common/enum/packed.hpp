@@ -0,0 +1,370 @@
+#pragma once
+#include "detail.hpp"
+#include "simd.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace trlc
+{
+namespace detail
+{
+/**
+ * @brief Writes the code units of a name into a zero-padded little-endian byte lane.
+ *
+ * @param name The name to write, at most `Bytes` bytes long.
+ * @param lane Receives the bytes.
+ */
+template<typename CharT, size_t Bytes>
+constexpr void packName(std::basic_string_view<CharT> name, std::array<unsigned char, Bytes>& lane)
+{
+    for (size_t index{0}; index < name.size(); ++index)
+    {
+        const auto unit{static_cast<std::make_unsigned_t<CharT>>(name[index])};
+        for (size_t byte{0}; byte < sizeof(CharT); ++byte)
+        {
+            lane[index * sizeof(CharT) + byte] = static_cast<unsigned char>(unit >> (8 * byte));
+        }
+    }
+}
+
+/**
+ * @brief A name of up to 16 bytes packed into two little-endian words.
+ */
+struct PackedName
+{
+    uint64_t low{0};  ///< Bytes 0 to 7.
+    uint64_t high{0}; ///< Bytes 8 to 15.
+    size_t length{0}; ///< The length of the name in code units.
+
+    constexpr bool operator<(const PackedName& other) const
+    {
+        if (low != other.low)
+        {
+            return low < other.low;
+        }
+        if (high != other.high)
+        {
+            return high < other.high;
+        }
+        return length < other.length;
+    }
+
+    constexpr bool operator==(const PackedName& other) const
+    {
+        return low == other.low && high == other.high && length == other.length;
+    }
+};
+
+/**
+ * @brief Packs a name of up to 16 bytes into two words.
+ *
+ * At runtime on little-endian targets the name is copied straight into the words; otherwise the
+ * words are assembled from the bytes written by `packName`, which gives the same result.
+ *
+ * @param name The name to pack.
+ * @return The packed name.
+ */
+template<typename CharT>
+constexpr PackedName packWords(std::basic_string_view<CharT> name)
+{
+    PackedName packed{};
+    packed.length = name.size();
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (!isConstantEvaluated())
+    {
+        uint64_t words[2]{};
+        if (!name.empty())
+        {
+            std::memcpy(words, name.data(), name.size() * sizeof(CharT));
+        }
+        packed.low = words[0];
+        packed.high = words[1];
+        return packed;
+    }
+#endif
+    std::array<unsigned char, 16> bytes{};
+    packName(name, bytes);
+    for (size_t byte{0}; byte < 8; ++byte)
+    {
+        packed.low |= static_cast<uint64_t>(bytes[byte]) << (8 * byte);
+        packed.high |= static_cast<uint64_t>(bytes[byte + 8]) << (8 * byte);
+    }
+    return packed;
+}
+} // namespace detail
+
+namespace policy
+{
+// SimdStringSearchPolicy definition
+/**
+ * @brief Search policy that compares a name against many short names at once with SIMD.
+ *
+ * The holder packs every name of up to 16 bytes into a zero-padded 16-byte lane at compile time,
+ * grouped by length. A lookup loads the query once and compares it with `pcmpeqb` (two lanes per
+ * `vpcmpeqb` with AVX2) against the names of the same length only, reading the match from a
+ * movemask. Longer names fall back to a plain comparison.
+ */
+struct SimdStringSearchPolicy
+{
+    static constexpr size_t kLaneBytes{16}; ///< The longest name, in bytes, that is packed into a lane.
+
+    /**
+     * @brief Names packed into lanes, grouped by length.
+     */
+    template<typename T, size_t N, typename CharT>
+    class Index
+    {
+    public:
+        constexpr explicit Index(const std::array<Enum<T, CharT>, N>& entries)
+        {
+            // Counting sort by length keeps table order within a length, so the first definition wins.
+            std::array<size_t, kLengths + 1> counts{};
+            for (const auto& entry : entries)
+            {
+                ++counts[lengthClass(entry.name.size())];
+            }
+            for (size_t length{0}; length < kLengths; ++length)
+            {
+                m_starts[length + 1] = m_starts[length] + counts[length];
+            }
+            std::array<size_t, kLengths> next{};
+            for (size_t length{0}; length < kLengths; ++length)
+            {
+                next[length] = m_starts[length];
+            }
+            for (size_t index{0}; index < N; ++index)
+            {
+                const size_t slot{next[lengthClass(entries[index].name.size())]++};
+                m_order[slot] = index;
+                if (entries[index].name.size() * sizeof(CharT) <= kLaneBytes)
+                {
+                    detail::packName(entries[index].name, m_lanes[slot].bytes);
+                }
+            }
+        }
+
+        /**
+         * @brief Searches for an Enum entry by name among the names of the same length.
+         *
+         * @param name The name to search for.
+         * @param entries The array of Enum entries.
+         * @return The corresponding Enum entry.
+         */
+        constexpr Enum<T, CharT> search(std::basic_string_view<CharT> name, const std::array<Enum<T, CharT>, N>& entries) const
+        {
+            const size_t length{lengthClass(name.size())};
+            if (length == kLengths - 1)
+            {
+                for (size_t slot{m_starts[length]}; slot < m_starts[length + 1]; ++slot)
+                {
+                    if (entries[m_order[slot]].name == name)
+                    {
+                        return entries[m_order[slot]];
+                    }
+                }
+                return default_unknown_enum<T, CharT>();
+            }
+
+            const size_t slot{findLane(name, m_starts[length], m_starts[length + 1])};
+            return slot < N ? entries[m_order[slot]] : default_unknown_enum<T, CharT>();
+        }
+
+    private:
+        /// Lengths in code units that fit a lane, plus one class for every longer name.
+        static constexpr size_t kLengths{kLaneBytes / sizeof(CharT) + 2};
+
+        struct alignas(kLaneBytes) Lane
+        {
+            std::array<unsigned char, kLaneBytes> bytes{};
+        };
+
+        static constexpr size_t lengthClass(size_t size)
+        {
+            return size < kLengths - 1 ? size : kLengths - 1;
+        }
+
+        constexpr size_t findLane(std::basic_string_view<CharT> name, size_t first, size_t last) const
+        {
+            Lane query{};
+#if defined(TRLC_ENUM_HAS_SSE2)
+            if (!detail::isConstantEvaluated())
+            {
+                if (!name.empty())
+                {
+                    std::memcpy(query.bytes.data(), name.data(), name.size() * sizeof(CharT));
+                }
+                const __m128i needle{_mm_load_si128(reinterpret_cast<const __m128i*>(query.bytes.data()))};
+                size_t slot{first};
+#if defined(__AVX2__)
+                const __m256i needles{_mm256_broadcastsi128_si256(needle)};
+                for (; slot + 2 <= last; slot += 2)
+                {
+                    const __m256i lanes{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(m_lanes[slot].bytes.data()))};
+                    const uint32_t mask{static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lanes, needles)))};
+                    if ((mask & 0xFFFFu) == 0xFFFFu)
+                    {
+                        return slot;
+                    }
+                    if ((mask >> 16) == 0xFFFFu)
+                    {
+                        return slot + 1;
+                    }
+                }
+#endif
+                for (; slot < last; ++slot)
+                {
+                    const __m128i lane{_mm_load_si128(reinterpret_cast<const __m128i*>(m_lanes[slot].bytes.data()))};
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi8(lane, needle)) == 0xFFFF)
+                    {
+                        return slot;
+                    }
+                }
+                return N;
+            }
+#endif
+            detail::packName(name, query.bytes);
+            for (size_t slot{first}; slot < last; ++slot)
+            {
+                bool equal{true};
+                for (size_t byte{0}; byte < kLaneBytes; ++byte)
+                {
+                    equal = equal && m_lanes[slot].bytes[byte] == query.bytes[byte];
+                }
+                if (equal)
+                {
+                    return slot;
+                }
+            }
+            return N;
+        }
+
+        std::array<Lane, N> m_lanes{};               ///< Packed names, in length order.
+        std::array<size_t, N> m_order{};             ///< Entry index of each lane.
+        std::array<size_t, kLengths + 1> m_starts{}; ///< First lane of each length.
+    };
+
+    /**
+     * @brief Searches for an Enum entry by name without packed lanes.
+     *
+     * @param name The name to search for.
+     * @param entries The array of Enum entries.
+     * @return The corresponding Enum entry.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr Enum<T, CharT> search(detail::TypeIdentityT<std::basic_string_view<CharT>> name, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        return CaseSensitiveStringSearchPolicy::search<T, N, CharT>(name, entries);
+    }
+};
+
+// PackedKeyStringSearchPolicy definition
+/**
+ * @brief Search policy that compares short names as integers.
+ *
+ * The holder encodes every name of up to 16 bytes as two zero-padded words at compile time and
+ * sorts them. A lookup copies the query into the same two words and binary-searches them with
+ * integer compares only. Longer names fall back to a plain comparison.
+ */
+struct PackedKeyStringSearchPolicy
+{
+    static constexpr size_t kKeyBytes{16}; ///< The longest name, in bytes, that is packed into a key.
+
+    /**
+     * @brief Sorted packed keys of the short names and the list of long names.
+     */
+    template<typename T, size_t N, typename CharT>
+    class Index
+    {
+    public:
+        constexpr explicit Index(const std::array<Enum<T, CharT>, N>& entries)
+        {
+            for (size_t index{0}; index < N; ++index)
+            {
+                if (entries[index].name.size() * sizeof(CharT) > kKeyBytes)
+                {
+                    m_long[m_longCount++] = index;
+                    continue;
+                }
+                // Insertion sort keeps equal keys in table order, so the first definition wins.
+                const detail::PackedName key{detail::packWords(entries[index].name)};
+                size_t slot{m_keyCount++};
+                while (slot > 0 && key < m_keys[slot - 1])
+                {
+                    m_keys[slot] = m_keys[slot - 1];
+                    m_order[slot] = m_order[slot - 1];
+                    --slot;
+                }
+                m_keys[slot] = key;
+                m_order[slot] = index;
+            }
+        }
+
+        /**
+         * @brief Searches for an Enum entry by name among the packed keys.
+         *
+         * @param name The name to search for.
+         * @param entries The array of Enum entries.
+         * @return The corresponding Enum entry.
+         */
+        constexpr Enum<T, CharT> search(std::basic_string_view<CharT> name, const std::array<Enum<T, CharT>, N>& entries) const
+        {
+            if (name.size() * sizeof(CharT) > kKeyBytes)
+            {
+                for (size_t slot{0}; slot < m_longCount; ++slot)
+                {
+                    if (entries[m_long[slot]].name == name)
+                    {
+                        return entries[m_long[slot]];
+                    }
+                }
+                return default_unknown_enum<T, CharT>();
+            }
+
+            const detail::PackedName key{detail::packWords(name)};
+            size_t left{0};
+            size_t right{m_keyCount};
+            while (left < right)
+            {
+                const size_t mid{left + (right - left) / 2};
+                if (m_keys[mid] < key)
+                {
+                    left = mid + 1;
+                }
+                else
+                {
+                    right = mid;
+                }
+            }
+            return (left < m_keyCount && m_keys[left] == key) ? entries[m_order[left]] : default_unknown_enum<T, CharT>();
+        }
+
+    private:
+        std::array<detail::PackedName, N> m_keys{}; ///< Packed short names, sorted.
+        std::array<size_t, N> m_order{};            ///< Entry index of each packed key.
+        std::array<size_t, N> m_long{};             ///< Entry indices of the names that do not fit a key.
+        size_t m_keyCount{0};                       ///< The number of packed keys.
+        size_t m_longCount{0};                      ///< The number of long names.
+    };
+
+    /**
+     * @brief Searches for an Enum entry by name without packed keys.
+     *
+     * @param name The name to search for.
+     * @param entries The array of Enum entries.
+     * @return The corresponding Enum entry.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr Enum<T, CharT> search(detail::TypeIdentityT<std::basic_string_view<CharT>> name, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        return CaseSensitiveStringSearchPolicy::search<T, N, CharT>(name, entries);
+    }
+};
+} // namespace policy
+} // namespace trlc
\ No newline at end of file
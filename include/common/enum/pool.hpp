@@ -0,0 +1,166 @@
+#pragma once
+#include "detail.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace trlc
+{
+
+/**
+ * @brief Interns the names of several Enum tables into one blob at compile time.
+ *
+ * Every distinct name is stored once in `kBlob`, and `kEntries<I>` is a copy of the `I`-th table
+ * whose names point into the blob. Holders built over the pooled tables share one copy of names
+ * such as `None` or `Unknown` without relying on linker string merging, and equal names of any two
+ * pooled tables share storage, so `Enum::operator==` and `CaseSensitiveStringSearchPolicy` match
+ * them with a pointer compare. Only the pooled tables and the blob need to be odr-used; the
+ * original tables are then dropped from the binary.
+ *
+ * Example: `using Pool = trlc::NamePool<kColors, kStates>;` then
+ * `constexpr ColorHolder kColorHolder{Pool::kEntries<0>};`
+ *
+ * @tparam Tables The `constexpr` `std::array<Enum<T, CharT>, N>` tables, with the same `CharT`.
+ */
+template<const auto&... Tables>
+class NamePool
+{
+    using FirstTable = std::remove_cv_t<std::remove_reference_t<decltype(std::get<0>(std::forward_as_tuple(Tables...)))>>;
+
+public:
+    using char_type = typename FirstTable::value_type::char_type; ///< The character type of the names.
+
+    static_assert((std::is_same_v<typename std::remove_cv_t<std::remove_reference_t<decltype(Tables)>>::value_type::char_type, char_type> && ...),
+                  "NamePool tables must use the same character type");
+
+    static constexpr size_t kNames{(Tables.size() + ...)}; ///< The number of names of all tables.
+
+private:
+    using Name = std::basic_string_view<char_type>;
+
+    struct Sorted
+    {
+        std::array<Name, kNames> names{}; ///< The distinct names, sorted.
+        size_t count{0};                  ///< The number of distinct names.
+        size_t length{0};                 ///< Their total length.
+    };
+
+    static constexpr Sorted sortNames()
+    {
+        Sorted sorted{};
+        size_t position{0};
+        ((
+             [&sorted, &position]() {
+                 for (const auto& entry : Tables)
+                 {
+                     sorted.names[position++] = entry.name;
+                 }
+             }()),
+         ...);
+
+        // Shell sort: compile-time friendly and fast enough for thousands of names.
+        for (size_t gap{kNames / 2}; gap > 0; gap /= 2)
+        {
+            for (size_t index{gap}; index < kNames; ++index)
+            {
+                const Name name{sorted.names[index]};
+                size_t slot{index};
+                for (; slot >= gap && name < sorted.names[slot - gap]; slot -= gap)
+                {
+                    sorted.names[slot] = sorted.names[slot - gap];
+                }
+                sorted.names[slot] = name;
+            }
+        }
+
+        for (size_t index{0}; index < kNames; ++index)
+        {
+            if (sorted.count == 0 || sorted.names[sorted.count - 1] != sorted.names[index])
+            {
+                sorted.length += sorted.names[index].size();
+                sorted.names[sorted.count++] = sorted.names[index];
+            }
+        }
+        return sorted;
+    }
+
+    static constexpr Sorted kSorted{sortNames()};
+
+    /// The offset of each distinct name in the blob, in sorted order, plus the end of the blob.
+    static constexpr std::array<size_t, kNames + 1> kOffsets{[]() {
+        std::array<size_t, kNames + 1> offsets{};
+        for (size_t index{0}; index < kSorted.count; ++index)
+        {
+            offsets[index + 1] = offsets[index] + kSorted.names[index].size();
+        }
+        return offsets;
+    }()};
+
+public:
+    static constexpr size_t kDistinct{kSorted.count}; ///< The number of distinct names.
+
+    /// The distinct names, sorted and concatenated; at least one code unit long.
+    static constexpr std::array<char_type, (kSorted.length > 0 ? kSorted.length : 1)> kBlob{[]() {
+        std::array<char_type, (kSorted.length > 0 ? kSorted.length : 1)> blob{};
+        for (size_t index{0}; index < kSorted.count; ++index)
+        {
+            for (size_t offset{0}; offset < kSorted.names[index].size(); ++offset)
+            {
+                blob[kOffsets[index] + offset] = kSorted.names[index][offset];
+            }
+        }
+        return blob;
+    }()};
+
+    /**
+     * @brief Returns the pooled copy of a name.
+     *
+     * @param name The name to intern.
+     * @return A view into the blob, or `name` itself if no pooled table has it.
+     */
+    static constexpr Name intern(Name name)
+    {
+        size_t left{0};
+        size_t right{kSorted.count};
+        while (left < right)
+        {
+            const size_t middle{left + (right - left) / 2};
+            if (kSorted.names[middle] < name)
+            {
+                left = middle + 1;
+            }
+            else
+            {
+                right = middle;
+            }
+        }
+        if (left < kSorted.count && kSorted.names[left] == name)
+        {
+            return Name{kBlob.data() + kOffsets[left], name.size()};
+        }
+        return name;
+    }
+
+private:
+    template<size_t I>
+    static constexpr auto pooled()
+    {
+        auto entries{std::get<I>(std::forward_as_tuple(Tables...))};
+        for (auto& entry : entries)
+        {
+            entry.name = intern(entry.name);
+        }
+        return entries;
+    }
+
+public:
+    /// The `I`-th table with its names pointing into `kBlob`.
+    template<size_t I>
+    static constexpr std::remove_cv_t<std::remove_reference_t<decltype(std::get<I>(std::forward_as_tuple(Tables...)))>> kEntries{pooled<I>()};
+};
+
+} // namespace trlc
\ No newline at end of file
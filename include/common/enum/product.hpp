@@ -0,0 +1,405 @@
+#pragma once
+#include "detail.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace trlc
+{
+
+namespace detail
+{
+/// The value type of the entries of a holder.
+template<class Holder>
+using HolderValueT = decltype(std::declval<typename std::remove_cv_t<std::remove_reference_t<decltype(std::declval<const Holder&>().m_entries)>>::value_type>().value);
+
+/**
+ * @brief Scrambles a 64-bit word (the splitmix64 finalizer).
+ */
+constexpr uint64_t mixBits(uint64_t word)
+{
+    word = (word ^ (word >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    word = (word ^ (word >> 27)) * 0x94d049bb133111ebULL;
+    return word ^ (word >> 31);
+}
+
+constexpr size_t bitCeil(size_t value)
+{
+    size_t result{1};
+    while (result < value)
+    {
+        result *= 2;
+    }
+    return result;
+}
+} // namespace detail
+
+/**
+ * @brief Numbers the combinations of one entry of each of several holders, e.g. `(state, event)`.
+ *
+ * A combination of entry slots `(i0, i1, ..., ik)` maps to the mixed-radix number
+ * `((i0 * N1 + i1) * N2 + ...) * Nk + ik`, a dense slot below the product of the holder sizes, so
+ * per-combination data fits a flat array instead of a `std::map` keyed by tuples.
+ *
+ * @tparam Holders The holder types, one per key component.
+ */
+template<class... Holders>
+class ProductIndex
+{
+    static constexpr size_t K{sizeof...(Holders)};
+    static constexpr std::array<size_t, K> kRadixes{Holders::size()...};
+
+public:
+    static constexpr size_t kSize{(Holders::size() * ... * size_t{1})}; ///< The number of combinations.
+
+    /**
+     * @brief Creates an index over holders.
+     *
+     * @param holders The holders, which must outlive the index.
+     */
+    constexpr ProductIndex(const Holders&... holders)
+        : m_holders(holders...)
+    {
+    }
+
+    /**
+     * @brief Returns the slot of a combination of entry slots.
+     *
+     * @param indices The slot of the entry of each holder.
+     * @return The slot of the combination, or `kSize` if a slot is past its holder.
+     */
+    static constexpr size_t fromIndices(const std::array<size_t, K>& indices)
+    {
+        size_t slot{0};
+        for (size_t component{0}; component < K; ++component)
+        {
+            if (indices[component] >= kRadixes[component])
+            {
+                return kSize;
+            }
+            slot = slot * kRadixes[component] + indices[component];
+        }
+        return slot;
+    }
+
+    /**
+     * @brief Returns the entry slots of a combination.
+     *
+     * @param slot The slot of the combination, below `kSize`.
+     * @return The slot of the entry of each holder.
+     */
+    static constexpr std::array<size_t, K> toIndices(size_t slot)
+    {
+        std::array<size_t, K> indices{};
+        for (size_t component{K}; component-- > 0;)
+        {
+            indices[component] = slot % kRadixes[component];
+            slot /= kRadixes[component];
+        }
+        return indices;
+    }
+
+    /**
+     * @brief Returns the slot of a combination of values.
+     *
+     * @param values The value of each holder.
+     * @return The slot of the combination, or `kSize` if a holder has no entry for its value.
+     */
+    constexpr size_t fromValues(detail::HolderValueT<Holders>... values) const
+    {
+        return fromValuesImpl(std::make_index_sequence<K>{}, values...);
+    }
+
+private:
+    template<size_t... I, typename... Values>
+    constexpr size_t fromValuesImpl(std::index_sequence<I...>, Values... values) const
+    {
+        return fromIndices({std::get<I>(m_holders).indexFromValue(values)...});
+    }
+
+    std::tuple<const Holders&...> m_holders; ///< The holders.
+};
+
+/**
+ * @brief Associates a value with a combination of holder values, as an entry of a product table.
+ *
+ * @tparam V The type of the associated value.
+ * @tparam Keys The value type of each holder.
+ */
+template<typename V, typename... Keys>
+struct ProductEntry
+{
+    std::tuple<Keys...> keys{}; ///< The combination of holder values.
+    V value{};                  ///< The associated value.
+};
+
+/**
+ * @brief A value for every combination of holder values, stored in one flat array indexed by `ProductIndex`.
+ *
+ * Lookups are one mixed-radix computation and one array load. Memory grows with the product of
+ * the holder sizes; use `SparseProductTable` when few combinations are used.
+ *
+ * @tparam V The type of the values.
+ * @tparam Holders The holder types, one per key component.
+ */
+template<typename V, class... Holders>
+class ProductTable
+{
+public:
+    using Index = ProductIndex<Holders...>;
+    using Entry = ProductEntry<V, detail::HolderValueT<Holders>...>;
+
+    /**
+     * @brief Creates a table from the values of some combinations; the others stay unset.
+     *
+     * When several entries share a combination, the first one wins.
+     *
+     * @param holders The holders, which must outlive the table.
+     * @param entries The values of the combinations.
+     */
+    template<size_t M>
+    constexpr ProductTable(const Holders&... holders, const std::array<Entry, M>& entries)
+        : m_index(holders...)
+    {
+        for (const auto& entry : entries)
+        {
+            const size_t slot{std::apply([this](const auto&... keys) { return m_index.fromValues(keys...); }, entry.keys)};
+            if (slot < Index::kSize && !m_used[slot])
+            {
+                m_values[slot] = entry.value;
+                m_used[slot] = true;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the value of a combination.
+     *
+     * @param keys The value of each holder.
+     * @return The value, or a value-initialized value if the combination is unset or a key is unknown.
+     */
+    constexpr V get(detail::HolderValueT<Holders>... keys) const
+    {
+        const size_t slot{m_index.fromValues(keys...)};
+        return slot < Index::kSize && m_used[slot] ? m_values[slot] : V{};
+    }
+
+    /**
+     * @brief Returns whether a combination has a value.
+     */
+    constexpr bool contains(detail::HolderValueT<Holders>... keys) const
+    {
+        const size_t slot{m_index.fromValues(keys...)};
+        return slot < Index::kSize && m_used[slot];
+    }
+
+    /**
+     * @brief Returns the index mapping combinations to slots.
+     */
+    constexpr const Index& index() const
+    {
+        return m_index;
+    }
+
+private:
+    Index m_index;                           ///< Maps combinations to slots.
+    std::array<V, Index::kSize> m_values{};  ///< The value of each combination.
+    std::array<bool, Index::kSize> m_used{}; ///< Whether each combination has a value.
+};
+
+/**
+ * @brief The values of a few combinations of holder values, found through a perfect hash of their dense slots.
+ *
+ * Only the `M` given combinations are stored. At construction, at compile time for a `constexpr`
+ * table, the slots are spread over buckets and each bucket gets a displacement that sends all its
+ * slots to free cells (hash and displace), so a lookup is two hashes, one compare and no probing.
+ * `static_assert(table.valid())` to reject unknown keys at compile time.
+ *
+ * @tparam V The type of the values.
+ * @tparam M The number of stored combinations.
+ * @tparam Holders The holder types, one per key component.
+ */
+template<typename V, size_t M, class... Holders>
+class SparseProductTable
+{
+public:
+    using Index = ProductIndex<Holders...>;
+    using Entry = ProductEntry<V, detail::HolderValueT<Holders>...>;
+
+    static constexpr size_t kCells{detail::bitCeil(M + M / 4 + 1)}; ///< The number of cells, at most 80% used.
+    static constexpr size_t kBuckets{M / 2 + 1};                     ///< The number of displacement buckets.
+
+    /**
+     * @brief Creates a table from the values of the combinations and builds the perfect hash.
+     *
+     * When several entries share a combination, the first one wins.
+     *
+     * @param holders The holders, which must outlive the table.
+     * @param entries The values of the combinations.
+     */
+    constexpr SparseProductTable(const Holders&... holders, const std::array<Entry, M>& entries)
+        : m_index(holders...)
+    {
+        for (auto& key : m_keys)
+        {
+            key = Index::kSize;
+        }
+        m_valid = true;
+
+        // Chain the entries of each bucket, dropping repeated combinations.
+        std::array<size_t, M> slots{};
+        std::array<size_t, M> next{};
+        std::array<size_t, kBuckets> heads{};
+        std::array<size_t, kBuckets> sizes{};
+        for (auto& head : heads)
+        {
+            head = M;
+        }
+        for (size_t entry{0}; entry < M; ++entry)
+        {
+            slots[entry] = std::apply([this](const auto&... keys) { return m_index.fromValues(keys...); }, entries[entry].keys);
+            if (slots[entry] == Index::kSize)
+            {
+                m_valid = false;
+                continue;
+            }
+            const size_t bucket{bucketOf(slots[entry])};
+            bool repeated{false};
+            for (size_t other{heads[bucket]}; other != M; other = next[other])
+            {
+                repeated = repeated || slots[other] == slots[entry];
+            }
+            if (!repeated)
+            {
+                // Append, so the chain keeps the entry order.
+                next[entry] = M;
+                size_t* link{&heads[bucket]};
+                while (*link != M)
+                {
+                    link = &next[*link];
+                }
+                *link = entry;
+                ++sizes[bucket];
+            }
+        }
+
+        // Place the largest buckets first, while most cells are free.
+        size_t largest{0};
+        for (const size_t size : sizes)
+        {
+            largest = size > largest ? size : largest;
+        }
+        for (size_t size{largest}; size > 0; --size)
+        {
+            for (size_t bucket{0}; bucket < kBuckets; ++bucket)
+            {
+                if (sizes[bucket] == size && !place(bucket, heads[bucket], next, slots, entries))
+                {
+                    m_valid = false;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Returns whether every key is known and every bucket found a displacement.
+     */
+    constexpr bool valid() const
+    {
+        return m_valid;
+    }
+
+    /**
+     * @brief Returns the value of a combination.
+     *
+     * @param keys The value of each holder.
+     * @return The value, or a value-initialized value if the combination is not stored.
+     */
+    constexpr V get(detail::HolderValueT<Holders>... keys) const
+    {
+        const size_t cell{find(m_index.fromValues(keys...))};
+        return cell < kCells ? m_values[cell] : V{};
+    }
+
+    /**
+     * @brief Returns whether a combination is stored.
+     */
+    constexpr bool contains(detail::HolderValueT<Holders>... keys) const
+    {
+        return find(m_index.fromValues(keys...)) < kCells;
+    }
+
+    /**
+     * @brief Returns the index mapping combinations to slots.
+     */
+    constexpr const Index& index() const
+    {
+        return m_index;
+    }
+
+private:
+    static constexpr size_t kMaxDisplacement{size_t{1} << 16};
+
+    static constexpr size_t bucketOf(size_t slot)
+    {
+        return static_cast<size_t>(detail::mixBits(slot) % kBuckets);
+    }
+
+    static constexpr size_t cellOf(size_t slot, size_t displacement)
+    {
+        return static_cast<size_t>(detail::mixBits(slot ^ (displacement * 0x9E3779B97F4A7C15ULL + 0x632BE59BD9B4E019ULL))) & (kCells - 1);
+    }
+
+    constexpr size_t find(size_t slot) const
+    {
+        if (slot >= Index::kSize)
+        {
+            return kCells;
+        }
+        const size_t cell{cellOf(slot, m_displacements[bucketOf(slot)])};
+        return m_keys[cell] == slot ? cell : kCells;
+    }
+
+    /// Finds the first displacement that sends every slot of a bucket to a free cell, and fills those cells.
+    constexpr bool place(size_t bucket, size_t head, const std::array<size_t, M>& next, const std::array<size_t, M>& slots, const std::array<Entry, M>& entries)
+    {
+        for (size_t displacement{0}; displacement < kMaxDisplacement; ++displacement)
+        {
+            bool fits{true};
+            for (size_t entry{head}; entry != M && fits; entry = next[entry])
+            {
+                const size_t cell{cellOf(slots[entry], displacement)};
+                fits = m_keys[cell] == Index::kSize;
+                // Two slots of the bucket landing on the same cell also collide.
+                for (size_t other{head}; other != entry && fits; other = next[other])
+                {
+                    fits = cellOf(slots[other], displacement) != cell;
+                }
+            }
+            if (fits)
+            {
+                m_displacements[bucket] = displacement;
+                for (size_t entry{head}; entry != M; entry = next[entry])
+                {
+                    const size_t cell{cellOf(slots[entry], displacement)};
+                    m_keys[cell] = slots[entry];
+                    m_values[cell] = entries[entry].value;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Index m_index;                                  ///< Maps combinations to slots.
+    std::array<size_t, kBuckets> m_displacements{}; ///< The displacement of each bucket.
+    std::array<size_t, kCells> m_keys{};            ///< The slot stored in each cell, `Index::kSize` when free.
+    std::array<V, kCells> m_values{};               ///< The value stored in each cell.
+    bool m_valid{false};                            ///< Whether every key is known and every bucket was placed.
+};
+
+} // namespace trlc
\ No newline at end of file
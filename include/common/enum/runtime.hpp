@@ -0,0 +1,368 @@
+#pragma once
+#include "../define.hpp"
+#include "detail.hpp"
+#include "hash.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace trlc
+{
+
+namespace detail
+{
+/**
+ * @brief Trims leading and trailing whitespace from a view.
+ *
+ * @param text The text to trim.
+ * @return The trimmed view.
+ */
+constexpr std::string_view trim(std::string_view text)
+{
+    constexpr std::string_view whitespace{" \t\r\n"};
+    const size_t first{text.find_first_not_of(whitespace)};
+    if (first == std::string_view::npos)
+    {
+        return {};
+    }
+    return text.substr(first, text.find_last_not_of(whitespace) - first + 1);
+}
+
+/**
+ * @brief Parses one `Name = Value` line of an enum dictionary file.
+ *
+ * Blank lines and lines starting with `#` carry no entry.
+ *
+ * @param line The line to parse.
+ * @param name Receives the entry name.
+ * @param value Receives the entry value.
+ * @param hasEntry Receives whether the line carries an entry.
+ * @return `true` if the line is well formed, otherwise `false`.
+ */
+template<typename T>
+bool parseDictionaryLine(std::string_view line, std::string_view& name, T& value, bool& hasEntry)
+{
+    static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "Dictionary files only support integral or enum values");
+    using Underlying = typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::common_type<T>>::type;
+
+    hasEntry = false;
+    line = trim(line);
+    if (line.empty() || line.front() == '#')
+    {
+        return true;
+    }
+
+    const size_t separator{line.find('=')};
+    if (separator == std::string_view::npos)
+    {
+        return false;
+    }
+    name = trim(line.substr(0, separator));
+    const std::string_view text{trim(line.substr(separator + 1))};
+
+    Underlying parsed{};
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), parsed);
+    if (name.empty() || error != std::errc{} || end != text.data() + text.size())
+    {
+        return false;
+    }
+    value = static_cast<T>(parsed);
+    hasEntry = true;
+    return true;
+}
+
+/**
+ * @brief Publishes a `std::shared_ptr` so readers can load it while a writer swaps it.
+ *
+ * Not lock-free with libstdc++: before C++20 the `std::atomic_load` overloads take a mutex from a
+ * global pool, and `std::atomic<std::shared_ptr>` spins on a lock bit. Loads and swaps are short, so
+ * a reader only ever waits for another load or swap, never for a rebuild.
+ *
+ * @tparam T The pointee type.
+ */
+template<typename T>
+class AtomicSharedPtr
+{
+public:
+    UNCOPYABLE(AtomicSharedPtr)
+
+    explicit AtomicSharedPtr(std::shared_ptr<T> ptr = {})
+        : m_ptr(std::move(ptr))
+    {
+    }
+
+    /**
+     * @brief Loads the currently published pointer.
+     */
+    std::shared_ptr<T> load() const
+    {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return m_ptr.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&m_ptr, std::memory_order_acquire);
+#endif
+    }
+
+    /**
+     * @brief Publishes a new pointer and returns the previous one.
+     */
+    std::shared_ptr<T> exchange(std::shared_ptr<T> ptr)
+    {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return m_ptr.exchange(std::move(ptr), std::memory_order_acq_rel);
+#else
+        return std::atomic_exchange_explicit(&m_ptr, std::move(ptr), std::memory_order_acq_rel);
+#endif
+    }
+
+private:
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<std::shared_ptr<T>> m_ptr;
+#else
+    std::shared_ptr<T> m_ptr;
+#endif
+};
+} // namespace detail
+
+/**
+ * @brief Holds Enum entries built at runtime, e.g. loaded from a dictionary file.
+ *
+ * The holder owns its names and keeps a hash index over names and a sorted index over values.
+ * Names are hashed with a random per-holder key and probe sequences are bounded, so names from
+ * untrusted input cannot be crafted to collide and slow lookups down.
+ * Each index is built on its first use, so a service that only looks names up never sorts the
+ * values; call `warmUp` to build both before latency-critical lookups.
+ * It is immutable once built; publish new versions through a `std::shared_ptr` (see `EnumDictionaryWatcher`).
+ * Names returned by lookups stay valid as long as the holder is alive.
+ *
+ * @tparam T The type of the enum value.
+ * @tparam UnknownPolicy The policy for handling unknown enums.
+ * @tparam CharT The character type of the names.
+ */
+template<typename T, class UnknownPolicy = policy::UnknownPolicy, typename CharT = char>
+class RuntimeEnumHolder
+{
+public:
+    using Definition = std::pair<T, std::basic_string<CharT>>;
+    using Ptr = std::shared_ptr<const RuntimeEnumHolder>;
+
+    UNCOPYABLE(RuntimeEnumHolder)
+
+    /**
+     * @brief Builds the holder and its indices from value/name definitions.
+     *
+     * When several definitions share a name or a value, the first one wins, like the linear policies.
+     *
+     * @param definitions The entries of the holder.
+     */
+    explicit RuntimeEnumHolder(const std::vector<Definition>& definitions)
+    {
+        size_t namesSize{0};
+        for (const auto& definition : definitions)
+        {
+            namesSize += definition.second.size();
+        }
+        m_names.reserve(namesSize);
+        for (const auto& definition : definitions)
+        {
+            m_names += definition.second;
+        }
+
+        m_entries.reserve(definitions.size());
+        size_t offset{0};
+        for (const auto& definition : definitions)
+        {
+            m_entries.push_back(Enum<T, CharT>{definition.first, std::basic_string_view<CharT>{m_names}.substr(offset, definition.second.size())});
+            offset += definition.second.size();
+        }
+    }
+
+    /**
+     * @brief Loads a holder from a dictionary file of `Name = Value` lines.
+     *
+     * Only available for `char` names.
+     *
+     * @param path The path of the dictionary file.
+     * @return The loaded holder, or an empty pointer if the file cannot be read or is malformed.
+     */
+    static Ptr fromFile(const std::string& path)
+    {
+        static_assert(std::is_same_v<CharT, char>, "Dictionary files are read as char names");
+        std::ifstream file{path};
+        if (!file)
+        {
+            return {};
+        }
+
+        std::vector<Definition> definitions;
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::string_view name;
+            T value{};
+            bool hasEntry{false};
+            if (!detail::parseDictionaryLine(line, name, value, hasEntry))
+            {
+                return {};
+            }
+            if (hasEntry)
+            {
+                definitions.emplace_back(value, std::string{name});
+            }
+        }
+        return std::make_shared<const RuntimeEnumHolder>(definitions);
+    }
+
+    /**
+     * @brief Retrieves an Enum entry from a value.
+     *
+     * @param value The enum value to search for.
+     * @return The corresponding Enum entry.
+     */
+    Enum<T, CharT> fromValue(T value) const
+    {
+        std::call_once(m_sortedOnce, [this]() { buildSortedIndex(); });
+        const auto it = std::lower_bound(m_sorted.begin(), m_sorted.end(), value, [this](uint32_t index, T key) { return m_entries[index].value < key; });
+        if (it != m_sorted.end() && m_entries[*it].value == value)
+        {
+            return m_entries[*it];
+        }
+        return UnknownPolicy::template handle<T>(value, m_entries);
+    }
+
+    /**
+     * @brief Retrieves an Enum entry from a string name.
+     *
+     * @param name The name to search for.
+     * @return The corresponding Enum entry.
+     */
+    Enum<T, CharT> fromString(std::basic_string_view<CharT> name) const
+    {
+        std::call_once(m_hashOnce, [this]() { buildHashIndex(); });
+        const size_t mask{m_slots.size() - 1};
+        size_t slot{detail::hashName(name, m_seed) & mask};
+        // No stored name lies further than `m_probeLimit` slots from its home slot.
+        for (size_t probe{0}; probe < m_probeLimit; ++probe, slot = (slot + 1) & mask)
+        {
+            const uint32_t index{m_slots[slot]};
+            if (index == kEmptySlot)
+            {
+                break;
+            }
+            if (m_entries[index].name == name)
+            {
+                return m_entries[index];
+            }
+        }
+        return UnknownPolicy::template handle<T>(name, m_entries);
+    }
+
+    /**
+     * @brief Builds every index that is not built yet, so later lookups never pay for it.
+     *
+     * Lookups build their index on first use otherwise; concurrent first lookups of one index wait
+     * for a single build, while lookups through the other index proceed.
+     */
+    void warmUp() const
+    {
+        std::call_once(m_hashOnce, [this]() { buildHashIndex(); });
+        std::call_once(m_sortedOnce, [this]() { buildSortedIndex(); });
+    }
+
+    /**
+     * @brief Retrieves all Enum values in definition order.
+     *
+     * @return The Enum entries.
+     */
+    const std::vector<Enum<T, CharT>>& allValues() const
+    {
+        return m_entries;
+    }
+
+    /**
+     * @brief Returns the number of entries.
+     */
+    size_t size() const
+    {
+        return m_entries.size();
+    }
+
+private:
+    static constexpr uint32_t kEmptySlot{UINT32_MAX};
+    static constexpr size_t kMaxProbe{64}; ///< The longest probe sequence a name may need before the index is rebuilt.
+
+    void buildHashIndex() const
+    {
+        // Power-of-two table kept at most half full so probe sequences stay short.
+        size_t capacity{2};
+        while (capacity < m_entries.size() * 2)
+        {
+            capacity *= 2;
+        }
+        // A probe sequence past the limit means unlucky or crafted names: retry with a new key and
+        // more room. Without the key, names cannot be chosen to defeat the retry.
+        while (!fillHashIndex(capacity, detail::nextHashSeed()))
+        {
+            capacity *= 2;
+        }
+    }
+
+    bool fillHashIndex(size_t capacity, const detail::HashSeed& seed) const
+    {
+        m_seed = seed;
+        m_slots.assign(capacity, kEmptySlot);
+        m_probeLimit = 1;
+
+        const size_t mask{capacity - 1};
+        for (uint32_t index{0}; index < m_entries.size(); ++index)
+        {
+            size_t slot{detail::hashName(m_entries[index].name, m_seed) & mask};
+            size_t probe{1};
+            while (m_slots[slot] != kEmptySlot && m_entries[m_slots[slot]].name != m_entries[index].name)
+            {
+                slot = (slot + 1) & mask;
+                if (++probe > kMaxProbe)
+                {
+                    return false;
+                }
+            }
+            if (m_slots[slot] == kEmptySlot)
+            {
+                m_slots[slot] = index;
+                m_probeLimit = std::max(m_probeLimit, probe);
+            }
+        }
+        return true;
+    }
+
+    void buildSortedIndex() const
+    {
+        m_sorted.resize(m_entries.size());
+        for (uint32_t index{0}; index < m_sorted.size(); ++index)
+        {
+            m_sorted[index] = index;
+        }
+        std::stable_sort(m_sorted.begin(), m_sorted.end(), [this](uint32_t lhs, uint32_t rhs) { return m_entries[lhs].value < m_entries[rhs].value; });
+        m_sorted.erase(std::unique(m_sorted.begin(), m_sorted.end(), [this](uint32_t lhs, uint32_t rhs) { return m_entries[lhs].value == m_entries[rhs].value; }), m_sorted.end());
+    }
+
+    std::basic_string<CharT> m_names;       ///< Storage of all names, referenced by the entries.
+    std::vector<Enum<T, CharT>> m_entries;  ///< The entries in definition order.
+    mutable std::once_flag m_hashOnce;      ///< Builds the hash index on first use.
+    mutable std::vector<uint32_t> m_slots;  ///< Open-addressing hash index from name to entry.
+    mutable detail::HashSeed m_seed;        ///< The key of the hash index.
+    mutable size_t m_probeLimit{1};         ///< The longest probe sequence of any name in the hash index.
+    mutable std::once_flag m_sortedOnce;    ///< Builds the sorted index on first use.
+    mutable std::vector<uint32_t> m_sorted; ///< Entry indices sorted by value.
+};
+
+} // namespace trlc
\ No newline at end of file
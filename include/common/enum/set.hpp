@@ -0,0 +1,363 @@
+#pragma once
+#include "detail.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace trlc
+{
+
+/**
+ * @brief A set of entries of a holder, stored as one bit per entry slot.
+ *
+ * Slots come from `EnumHolder::indexFromValue` and `indexFromString`; the slot `N` they return for
+ * unknown entries is never a member, so membership of any lookup result is a single bit test.
+ *
+ * @tparam N The number of entries of the holder.
+ */
+template<size_t N>
+class EnumSet
+{
+public:
+    constexpr EnumSet() = default;
+
+    /**
+     * @brief Adds an entry.
+     *
+     * @param index The slot of the entry; slots past `N` are ignored.
+     */
+    constexpr void set(size_t index)
+    {
+        if (index < N)
+        {
+            m_words[index / 64] |= uint64_t{1} << (index % 64);
+        }
+    }
+
+    /**
+     * @brief Removes an entry.
+     *
+     * @param index The slot of the entry; slots past `N` are ignored.
+     */
+    constexpr void reset(size_t index)
+    {
+        if (index < N)
+        {
+            m_words[index / 64] &= ~(uint64_t{1} << (index % 64));
+        }
+    }
+
+    /**
+     * @brief Returns whether an entry is in the set.
+     *
+     * @param index The slot of the entry.
+     * @return `true` if the entry is in the set, `false` otherwise or if the slot is past `N`.
+     */
+    constexpr bool test(size_t index) const
+    {
+        return index < N && ((m_words[index / 64] >> (index % 64)) & 1) != 0;
+    }
+
+    /**
+     * @brief Returns the number of entries in the set.
+     */
+    constexpr size_t count() const
+    {
+        size_t result{0};
+        for (uint64_t word : m_words)
+        {
+            for (; word != 0; word &= word - 1)
+            {
+                ++result;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns whether the set holds at least one entry.
+     */
+    constexpr bool any() const
+    {
+        for (const uint64_t word : m_words)
+        {
+            if (word != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns whether the set is empty.
+     */
+    constexpr bool none() const
+    {
+        return !any();
+    }
+
+    constexpr EnumSet& operator|=(const EnumSet& other)
+    {
+        for (size_t word{0}; word < kWords; ++word)
+        {
+            m_words[word] |= other.m_words[word];
+        }
+        return *this;
+    }
+
+    constexpr EnumSet& operator&=(const EnumSet& other)
+    {
+        for (size_t word{0}; word < kWords; ++word)
+        {
+            m_words[word] &= other.m_words[word];
+        }
+        return *this;
+    }
+
+    constexpr EnumSet& operator^=(const EnumSet& other)
+    {
+        for (size_t word{0}; word < kWords; ++word)
+        {
+            m_words[word] ^= other.m_words[word];
+        }
+        return *this;
+    }
+
+    constexpr EnumSet operator|(const EnumSet& other) const
+    {
+        EnumSet result{*this};
+        return result |= other;
+    }
+
+    constexpr EnumSet operator&(const EnumSet& other) const
+    {
+        EnumSet result{*this};
+        return result &= other;
+    }
+
+    constexpr EnumSet operator^(const EnumSet& other) const
+    {
+        EnumSet result{*this};
+        return result ^= other;
+    }
+
+    /**
+     * @brief Returns the entries that are not in the set.
+     */
+    constexpr EnumSet operator~() const
+    {
+        EnumSet result{};
+        for (size_t word{0}; word < kWords; ++word)
+        {
+            result.m_words[word] = ~m_words[word];
+        }
+        if constexpr (N % 64 != 0)
+        {
+            result.m_words[kWords - 1] &= (uint64_t{1} << (N % 64)) - 1;
+        }
+        return result;
+    }
+
+    constexpr bool operator==(const EnumSet& other) const
+    {
+        for (size_t word{0}; word < kWords; ++word)
+        {
+            if (m_words[word] != other.m_words[word])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool operator!=(const EnumSet& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    static constexpr size_t kWords{N == 0 ? 1 : (N + 63) / 64};
+
+    std::array<uint64_t, kWords> m_words{}; ///< The membership bits, slot `i` in bit `i % 64` of word `i / 64`.
+};
+
+namespace detail
+{
+/**
+ * @brief Matches the glob token at `position` against one character.
+ *
+ * Tokens are `?`, a bracket class such as `[a-z]` or `[!0-9]`, a character escaped with `\` or a
+ * literal character. A `[` without a closing `]` is a literal.
+ *
+ * @param pattern The glob pattern.
+ * @param position The start of the token.
+ * @param c The character to match.
+ * @param next Receives the position past the token.
+ * @return `true` if the token matches the character, otherwise `false`.
+ */
+template<typename CharT>
+constexpr bool globToken(std::basic_string_view<CharT> pattern, size_t position, CharT c, size_t& next)
+{
+    const CharT token{pattern[position]};
+    if (token == CharT('?'))
+    {
+        next = position + 1;
+        return true;
+    }
+    if (token == CharT('\\') && position + 1 < pattern.size())
+    {
+        next = position + 2;
+        return pattern[position + 1] == c;
+    }
+    if (token == CharT('['))
+    {
+        size_t cursor{position + 1};
+        const bool negate{cursor < pattern.size() && (pattern[cursor] == CharT('!') || pattern[cursor] == CharT('^'))};
+        cursor += negate ? 1 : 0;
+        bool matched{false};
+        // A `]` right after the opening bracket is a member, not the end of the class.
+        for (bool first{true}; cursor < pattern.size() && (first || pattern[cursor] != CharT(']')); first = false)
+        {
+            if (cursor + 2 < pattern.size() && pattern[cursor + 1] == CharT('-') && pattern[cursor + 2] != CharT(']'))
+            {
+                matched = matched || (pattern[cursor] <= c && c <= pattern[cursor + 2]);
+                cursor += 3;
+            }
+            else
+            {
+                matched = matched || pattern[cursor] == c;
+                ++cursor;
+            }
+        }
+        if (cursor < pattern.size())
+        {
+            next = cursor + 1;
+            return matched != negate;
+        }
+    }
+    next = position + 1;
+    return token == c;
+}
+
+/**
+ * @brief Matches a whole name against a glob pattern.
+ *
+ * `*` matches any run of characters, including an empty one. Backtracks to the last `*` only, so
+ * the cost stays linear in the name for each star.
+ *
+ * @param pattern The glob pattern.
+ * @param name The name to match.
+ * @return `true` if the pattern matches the whole name, otherwise `false`.
+ */
+template<typename CharT>
+constexpr bool globMatch(std::basic_string_view<CharT> pattern, std::basic_string_view<CharT> name)
+{
+    constexpr size_t kNoStar{static_cast<size_t>(-1)};
+    size_t position{0};
+    size_t index{0};
+    size_t star{kNoStar};
+    size_t starIndex{0};
+    while (index < name.size())
+    {
+        if (position < pattern.size() && pattern[position] == CharT('*'))
+        {
+            star = ++position;
+            starIndex = index;
+            continue;
+        }
+        size_t next{position};
+        if (position < pattern.size() && globToken(pattern, position, name[index], next))
+        {
+            position = next;
+            ++index;
+            continue;
+        }
+        if (star == kNoStar)
+        {
+            return false;
+        }
+        position = star;
+        index = ++starIndex;
+    }
+    while (position < pattern.size() && pattern[position] == CharT('*'))
+    {
+        ++position;
+    }
+    return position == pattern.size();
+}
+} // namespace detail
+
+/**
+ * @brief Selects the entries of a holder whose name matches a glob pattern such as `Err*` or `NET_?_[A-Z]*`.
+ *
+ * Usable at compile time on a `constexpr` holder.
+ *
+ * @param holder The holder whose entries are selected.
+ * @param pattern The glob pattern, matched against the whole name.
+ * @return The set of matching entries.
+ */
+template<class Holder, typename CharT = typename Holder::char_type>
+constexpr EnumSet<Holder::size()> selectGlob(const Holder& holder, detail::TypeIdentityT<std::basic_string_view<CharT>> pattern)
+{
+    EnumSet<Holder::size()> result{};
+    for (size_t index{0}; index < Holder::size(); ++index)
+    {
+        if (detail::globMatch(pattern, holder.m_entries[index].name))
+        {
+            result.set(index);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Selects the entries of a holder whose name contains a match of an ECMAScript regular
+ * expression; anchor it with `^` and `$` to match whole names, e.g. `^NET_.*_TIMEOUT$`.
+ *
+ * The expression is compiled and evaluated once here, so filtering afterwards costs a bit test.
+ * Only available for `char` and `wchar_t` names.
+ *
+ * @param holder The holder whose entries are selected.
+ * @param pattern The regular expression.
+ * @param flags The syntax options of the expression.
+ * @return The set of matching entries, or no value if the expression is invalid.
+ */
+template<class Holder, typename CharT = typename Holder::char_type>
+std::optional<EnumSet<Holder::size()>> selectRegex(const Holder& holder, detail::TypeIdentityT<std::basic_string_view<CharT>> pattern,
+                                                   std::regex_constants::syntax_option_type flags = std::regex_constants::ECMAScript)
+{
+    static_assert(std::is_same_v<CharT, char> || std::is_same_v<CharT, wchar_t>, "std::regex only supports char and wchar_t names");
+    std::basic_regex<CharT> expression;
+#if defined(__cpp_exceptions)
+    try
+    {
+        expression.assign(pattern.data(), pattern.size(), flags | std::regex_constants::optimize);
+    }
+    catch (const std::regex_error&)
+    {
+        return std::nullopt;
+    }
+#else
+    expression.assign(pattern.data(), pattern.size(), flags | std::regex_constants::optimize);
+#endif
+
+    EnumSet<Holder::size()> result{};
+    for (size_t index{0}; index < Holder::size(); ++index)
+    {
+        const auto name{holder.m_entries[index].name};
+        if (std::regex_search(name.begin(), name.end(), expression))
+        {
+            result.set(index);
+        }
+    }
+    return result;
+}
+
+} // namespace trlc
\ No newline at end of file
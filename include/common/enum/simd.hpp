@@ -0,0 +1,85 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TRLC_ENUM_HAS_SSE2 1
+#endif
+
+namespace trlc
+{
+namespace detail
+{
+/**
+ * @brief Returns whether the call happens during constant evaluation.
+ *
+ * Kernels use it to pick a portable loop at compile time and an intrinsic path at runtime.
+ * Without compiler support the portable loop is always used.
+ */
+constexpr bool isConstantEvaluated()
+{
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief Returns whether a text only contains ASCII characters.
+ *
+ * Checks 16 bytes per step with SSE2 at runtime, for every character width.
+ *
+ * @param text The text to check.
+ * @return `true` if every code unit is below 0x80, otherwise `false`.
+ */
+template<typename CharT>
+constexpr bool isAscii(std::basic_string_view<CharT> text)
+{
+    size_t index{0};
+#if defined(TRLC_ENUM_HAS_SSE2)
+    if (!isConstantEvaluated())
+    {
+        constexpr size_t kLane{16 / sizeof(CharT)};
+        __m128i bits{_mm_setzero_si128()};
+        for (; index + kLane <= text.size(); index += kLane)
+        {
+            bits = _mm_or_si128(bits, _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + index)));
+        }
+        // Keep every bit of each code unit except its low seven.
+        __m128i nonAscii{};
+        if constexpr (sizeof(CharT) == 1)
+        {
+            nonAscii = _mm_set1_epi8(static_cast<char>(0x80));
+        }
+        else if constexpr (sizeof(CharT) == 2)
+        {
+            nonAscii = _mm_set1_epi16(static_cast<short>(0xFF80));
+        }
+        else
+        {
+            nonAscii = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bits, nonAscii), _mm_setzero_si128())) != 0xFFFF)
+        {
+            return false;
+        }
+    }
+#endif
+    for (; index < text.size(); ++index)
+    {
+        if (static_cast<std::make_unsigned_t<CharT>>(text[index]) >= 0x80)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace detail
+} // namespace trlc
\ No newline at end of file
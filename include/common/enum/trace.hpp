@@ -0,0 +1,318 @@
+#pragma once
+
+#if defined(TRLC_ENUM_TRACE)
+#include "../define.hpp"
+#include "simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TRLC_ENUM_TRACE_RDTSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define TRLC_ENUM_TRACE_RDTSC 1
+#endif
+
+#if !defined(TRLC_ENUM_TRACE_CAPACITY)
+#define TRLC_ENUM_TRACE_CAPACITY 4096 ///< Records kept per thread, a power of two; older records are overwritten.
+#endif
+
+#if !defined(TRLC_ENUM_TRACE_EVERY)
+#define TRLC_ENUM_TRACE_EVERY 1 ///< Records one lookup out of this many per thread.
+#endif
+
+namespace trlc
+{
+namespace detail
+{
+static_assert((TRLC_ENUM_TRACE_CAPACITY & (TRLC_ENUM_TRACE_CAPACITY - 1)) == 0, "TRLC_ENUM_TRACE_CAPACITY must be a power of two");
+
+/**
+ * @brief The kind of a traced lookup.
+ */
+enum class TraceKind : uint8_t
+{
+    Value = 0, ///< `fromValue`.
+    String = 1 ///< `fromString`.
+};
+
+/**
+ * @brief Reads the trace clock: the time-stamp counter on x86, `steady_clock` nanoseconds elsewhere.
+ */
+inline uint64_t traceTicks()
+{
+#if defined(TRLC_ENUM_TRACE_RDTSC)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * @brief Returns the nanoseconds of `steady_clock`.
+ */
+inline uint64_t traceNanos()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief Returns the qualified name of a type, taken from the compiler's function signature.
+ */
+template<typename T>
+std::string_view typeName()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    const std::string_view signature{__FUNCSIG__};
+    const size_t first{signature.find("typeName<") + 9};
+    const size_t last{signature.rfind(">(")};
+#else
+    const std::string_view signature{__PRETTY_FUNCTION__};
+    const size_t first{signature.find("T = ") + 4};
+    const size_t last{signature.find_first_of(";]", first)};
+#endif
+    return signature.substr(first, last - first);
+}
+
+/**
+ * @brief Fixed-size records of one thread, written by that thread only.
+ *
+ * A record is four words stored with relaxed atomics; `head` is published with release so a
+ * reader on another thread sees complete records and can detect the ones overwritten meanwhile.
+ */
+struct TraceRing
+{
+    static constexpr size_t kCapacity{TRLC_ENUM_TRACE_CAPACITY};
+
+    std::array<std::array<std::atomic<uint64_t>, 4>, kCapacity> records{}; ///< Start, duration and flags, key, policy name.
+    std::atomic<uint64_t> head{0};                                         ///< The number of records written so far.
+    uint32_t thread{0};                                                    ///< Sequential id of the owning thread.
+    uint32_t skipped{0};                                                   ///< Lookups skipped since the last record.
+};
+
+/**
+ * @brief The rings of every thread that traced a lookup, and the clock origin.
+ */
+struct TraceRegistry
+{
+    std::mutex mutex;                              ///< Guards `rings` and `free`; taken once per thread, not per lookup.
+    std::vector<std::shared_ptr<TraceRing>> rings; ///< Every ring ever created; exported even after their thread exits.
+    std::vector<std::shared_ptr<TraceRing>> free;  ///< Rings of exited threads, reused by the next threads that trace.
+    const uint64_t originTicks{traceTicks()};      ///< Trace clock at the first traced lookup.
+    const uint64_t originNanos{traceNanos()};      ///< `steady_clock` at the first traced lookup.
+};
+
+inline TraceRegistry& traceRegistry()
+{
+    static TraceRegistry registry;
+    return registry;
+}
+
+/**
+ * @brief Holds the ring of one thread and hands it back to the registry when the thread exits.
+ *
+ * A reused ring keeps its id and its records, so the lookups of the exited thread stay in the export
+ * until the new owner overwrites them; the registry grows with the number of concurrent threads only.
+ */
+struct TraceRingLease
+{
+    TraceRingLease()
+    {
+        TraceRegistry& registry{traceRegistry()};
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        if (!registry.free.empty())
+        {
+            ring = std::move(registry.free.back());
+            registry.free.pop_back();
+            ring->skipped = 0;
+            return;
+        }
+        ring = std::make_shared<TraceRing>();
+        ring->thread = static_cast<uint32_t>(registry.rings.size());
+        registry.rings.push_back(ring);
+    }
+
+    ~TraceRingLease()
+    {
+        TraceRegistry& registry{traceRegistry()};
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        registry.free.push_back(std::move(ring));
+    }
+
+    UNCOPYABLE(TraceRingLease)
+
+    std::shared_ptr<TraceRing> ring; ///< The ring owned by the calling thread.
+};
+
+/**
+ * @brief Returns the ring of the calling thread, taking one on first use.
+ */
+inline TraceRing& traceRing()
+{
+    thread_local const TraceRingLease lease;
+    return *lease.ring;
+}
+
+/**
+ * @brief Reduces a looked-up value to the key stored in its record.
+ */
+template<typename T>
+uint64_t traceKey(const T& value)
+{
+    if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+    {
+        return static_cast<uint64_t>(value);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief Reduces a looked-up name to the FNV-1a hash stored in its record.
+ */
+template<typename CharT>
+uint64_t traceKey(std::basic_string_view<CharT> name)
+{
+    uint64_t hash{14695981039346656037ULL};
+    for (const CharT c : name)
+    {
+        hash = (hash ^ static_cast<std::make_unsigned_t<CharT>>(c)) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Appends the record of a finished lookup to the calling thread's ring.
+ *
+ * @param start The trace clock when the lookup started.
+ * @param kind The kind of lookup.
+ * @param key The key of the value or name looked up.
+ * @param found Whether the search policy found an entry, before the unknown policy.
+ */
+template<class Policy>
+void traceRecord(uint64_t start, TraceKind kind, uint64_t key, bool found)
+{
+    const uint64_t end{traceTicks()};
+    TraceRing& ring{traceRing()};
+    if (++ring.skipped < TRLC_ENUM_TRACE_EVERY)
+    {
+        return;
+    }
+    ring.skipped = 0;
+
+    static const std::string_view policy{typeName<Policy>()};
+    const uint64_t head{ring.head.load(std::memory_order_relaxed)};
+    // Orders the previous `head` before the record stores, so a reader that sees them overwritten also sees the new `head`.
+    std::atomic_thread_fence(std::memory_order_release);
+    auto& record{ring.records[head & (TraceRing::kCapacity - 1)]};
+    const uint64_t duration{std::min<uint64_t>(end - start, UINT32_MAX)};
+    record[0].store(start, std::memory_order_relaxed);
+    record[1].store(duration | static_cast<uint64_t>(kind) << 32 | static_cast<uint64_t>(found) << 40 | static_cast<uint64_t>(policy.size()) << 48, std::memory_order_relaxed);
+    record[2].store(key, std::memory_order_relaxed);
+    record[3].store(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(policy.data())), std::memory_order_relaxed);
+    ring.head.store(head + 1, std::memory_order_release);
+}
+} // namespace detail
+
+/**
+ * @brief Writes the traced lookups of every thread as Chrome trace JSON (`chrome://tracing`, Perfetto).
+ *
+ * Safe to call while other threads keep tracing; records overwritten during the export are left out.
+ *
+ * @param out The stream to write to.
+ * @return The number of events written.
+ */
+inline size_t writeEnumTrace(std::ostream& out)
+{
+    detail::TraceRegistry& registry{detail::traceRegistry()};
+    std::vector<std::shared_ptr<detail::TraceRing>> rings;
+    {
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        rings = registry.rings;
+    }
+
+    const uint64_t ticks{detail::traceTicks() - registry.originTicks};
+    const uint64_t nanos{detail::traceNanos() - registry.originNanos};
+    const double nanosPerTick{ticks > 0 && nanos > 0 ? static_cast<double>(nanos) / static_cast<double>(ticks) : 1.0};
+
+    // Fixed microseconds with nanosecond digits: the default six significant digits would round
+    // timestamps to whole milliseconds after a few minutes of tracing.
+    const std::ios_base::fmtflags flags{out.flags(std::ios_base::dec | std::ios_base::fixed)};
+    const std::streamsize precision{out.precision(3)};
+
+    size_t events{0};
+    out << "{\"traceEvents\":[";
+    for (const auto& ring : rings)
+    {
+        constexpr uint64_t kCapacity{detail::TraceRing::kCapacity};
+        const uint64_t head{ring->head.load(std::memory_order_acquire)};
+        std::vector<std::array<uint64_t, 4>> records;
+        for (uint64_t index{head > kCapacity ? head - kCapacity : 0}; index < head; ++index)
+        {
+            const auto& record{ring->records[index & (kCapacity - 1)]};
+            records.push_back({record[0].load(std::memory_order_relaxed), record[1].load(std::memory_order_relaxed), record[2].load(std::memory_order_relaxed),
+                               record[3].load(std::memory_order_relaxed)});
+        }
+        // The writer may have overwritten the oldest records while they were copied; the fence keeps
+        // the copies above from being reordered after the second read of `head`.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t after{ring->head.load(std::memory_order_acquire)};
+        const uint64_t valid{after >= kCapacity ? after - kCapacity + 1 : 0};
+        const uint64_t first{head > kCapacity ? head - kCapacity : 0};
+
+        for (uint64_t index{std::max(first, valid)}; index < head; ++index)
+        {
+            const auto& record{records[index - first]};
+            const double start{static_cast<double>(record[0] > registry.originTicks ? record[0] - registry.originTicks : 0) * nanosPerTick / 1000.0};
+            const double duration{static_cast<double>(record[1] & UINT32_MAX) * nanosPerTick / 1000.0};
+            const bool isString{((record[1] >> 32) & 0xFF) == static_cast<uint64_t>(detail::TraceKind::String)};
+            const bool found{((record[1] >> 40) & 0xFF) != 0};
+            const std::string_view policy{reinterpret_cast<const char*>(static_cast<uintptr_t>(record[3])), static_cast<size_t>(record[1] >> 48)};
+
+            out << (events++ > 0 ? "," : "") << "{\"name\":\"" << (isString ? "fromString" : "fromValue") << "\",\"cat\":\"trlc::enum\",\"ph\":\"X\",\"ts\":" << start
+                << ",\"dur\":" << duration << ",\"pid\":0,\"tid\":" << ring->thread << ",\"args\":{\"policy\":\"";
+            for (const char c : policy)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    out << '\\';
+                }
+                out << c;
+            }
+            out << "\",\"found\":" << (found ? "true" : "false") << ",\"key\":" << record[2] << "}}";
+        }
+    }
+    out << "]}";
+    out.flags(flags);
+    out.precision(precision);
+    return events;
+}
+} // namespace trlc
+
+/// Starts timing a lookup in `EnumHolder`; nothing is recorded during constant evaluation.
+#define TRLC_ENUM_TRACE_BEGIN(start) uint64_t start{trlc::detail::isConstantEvaluated() ? 0 : trlc::detail::traceTicks()}
+
+/// Records a lookup in `EnumHolder` into the calling thread's ring.
+#define TRLC_ENUM_TRACE_END(start, Policy, kind, key, found)                            \
+    if (!trlc::detail::isConstantEvaluated())                                           \
+    {                                                                                   \
+        trlc::detail::traceRecord<Policy>(start, kind, trlc::detail::traceKey(key), found); \
+    }
+#else
+#define TRLC_ENUM_TRACE_BEGIN(start)
+#define TRLC_ENUM_TRACE_END(start, Policy, kind, key, found)
+#endif
\ No newline at end of file
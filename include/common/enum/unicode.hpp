@@ -0,0 +1,389 @@
+#pragma once
+#include "detail.hpp"
+#include "simd.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace trlc
+{
+namespace detail
+{
+/**
+ * @brief Applies Unicode simple case folding to a code point.
+ *
+ * Covers ASCII, Latin-1, Latin Extended-A, Latin Extended Additional, Greek, Cyrillic, Armenian
+ * and fullwidth Latin letters. Other code points are returned unchanged.
+ *
+ * @param c The code point to fold.
+ * @return The folded code point.
+ */
+constexpr char32_t foldCodePoint(char32_t c)
+{
+    if (c < 0x80)
+    {
+        return (c >= U'A' && c <= U'Z') ? c + 32 : c;
+    }
+    if (c < 0x100)
+    {
+        if (c == 0xB5)
+        {
+            return 0x3BC; // MICRO SIGN folds to GREEK SMALL LETTER MU
+        }
+        return (c >= 0xC0 && c <= 0xDE && c != 0xD7) ? c + 32 : c;
+    }
+    if (c < 0x180)
+    {
+        if ((c <= 0x12F || (c >= 0x132 && c <= 0x137) || (c >= 0x14A && c <= 0x177)) && c % 2 == 0)
+        {
+            return c + 1;
+        }
+        if (((c >= 0x139 && c <= 0x148) || (c >= 0x179 && c <= 0x17E)) && c % 2 == 1)
+        {
+            return c + 1;
+        }
+        if (c == 0x178)
+        {
+            return 0xFF;
+        }
+        return c == 0x17F ? U's' : c;
+    }
+    if (c >= 0x370 && c < 0x400)
+    {
+        if ((c <= 0x373 || c == 0x376 || (c >= 0x3D8 && c <= 0x3EF)) && c % 2 == 0)
+        {
+            return c + 1; // heta, archaic sampi, pamphylian digamma, archaic letters and Coptic
+        }
+        if (c >= 0x3FD)
+        {
+            return c - 130; // reversed lunate sigmas
+        }
+        switch (c)
+        {
+        case 0x37F:
+            return 0x3F3; // yot
+        case 0x3CF:
+            return 0x3D7; // kai
+        case 0x3D0:
+            return 0x3B2; // symbol variants fold to their letters
+        case 0x3D1:
+        case 0x3F4:
+            return 0x3B8;
+        case 0x3D5:
+            return 0x3C6;
+        case 0x3D6:
+            return 0x3C0;
+        case 0x3F0:
+            return 0x3BA;
+        case 0x3F1:
+            return 0x3C1;
+        case 0x3F5:
+            return 0x3B5;
+        case 0x3F7:
+        case 0x3FA:
+            return c + 1; // sho, san
+        case 0x3F9:
+            return 0x3F2; // lunate sigma
+        default:
+            break;
+        }
+        if (c == 0x386)
+        {
+            return 0x3AC;
+        }
+        if (c >= 0x388 && c <= 0x38A)
+        {
+            return c + 37;
+        }
+        if (c == 0x38C)
+        {
+            return 0x3CC;
+        }
+        if (c == 0x38E || c == 0x38F)
+        {
+            return c + 63;
+        }
+        if ((c >= 0x391 && c <= 0x3A1) || (c >= 0x3A3 && c <= 0x3AB))
+        {
+            return c + 32;
+        }
+        return c == 0x3C2 ? 0x3C3 : c; // final sigma
+    }
+    if (c >= 0x400 && c < 0x530)
+    {
+        if (c < 0x410)
+        {
+            return c + 80;
+        }
+        if (c < 0x430)
+        {
+            return c + 32;
+        }
+        if (((c >= 0x460 && c <= 0x481) || (c >= 0x48A && c <= 0x4BF) || (c >= 0x4D0 && c <= 0x52F)) && c % 2 == 0)
+        {
+            return c + 1;
+        }
+        // Between those ranges the pairs start on an odd code point.
+        if (c >= 0x4C1 && c <= 0x4CE && c % 2 == 1)
+        {
+            return c + 1;
+        }
+        return c == 0x4C0 ? 0x4CF : c; // palochka
+    }
+    if (c >= 0x531 && c <= 0x556)
+    {
+        return c + 48;
+    }
+    if (((c >= 0x1E00 && c <= 0x1E95) || (c >= 0x1EA0 && c <= 0x1EFF)) && c % 2 == 0)
+    {
+        return c + 1;
+    }
+    if (c == 0x1E9E)
+    {
+        return 0xDF; // capital sharp s
+    }
+    if (c == 0x1E9B)
+    {
+        return 0x1E61; // long s with dot above
+    }
+    if (c >= 0xFF21 && c <= 0xFF3A)
+    {
+        return c + 32;
+    }
+    return c;
+}
+
+/**
+ * @brief Decodes the next code point of a text.
+ *
+ * One-byte characters are decoded as UTF-8, two-byte characters as UTF-16 and four-byte characters
+ * as UTF-32. Malformed units decode to themselves offset past the Unicode range, so they still
+ * compare unit by unit.
+ *
+ * @param text The text to decode.
+ * @param index The position of the next code unit, advanced past the decoded sequence.
+ * @return The decoded code point.
+ */
+template<typename CharT>
+constexpr char32_t decodeCodePoint(std::basic_string_view<CharT> text, size_t& index)
+{
+    const auto unit = [&text](size_t position) { return static_cast<char32_t>(static_cast<std::make_unsigned_t<CharT>>(text[position])); };
+    const char32_t lead{unit(index)};
+    if constexpr (sizeof(CharT) == 4)
+    {
+        ++index;
+        return lead;
+    }
+    else if constexpr (sizeof(CharT) == 2)
+    {
+        if (lead >= 0xD800 && lead < 0xDC00 && index + 1 < text.size() && unit(index + 1) >= 0xDC00 && unit(index + 1) < 0xE000)
+        {
+            const char32_t trail{unit(index + 1)};
+            index += 2;
+            return 0x10000 + ((lead - 0xD800) << 10) + (trail - 0xDC00);
+        }
+        ++index;
+        return (lead >= 0xD800 && lead < 0xE000) ? 0x110000 + lead : lead;
+    }
+    else
+    {
+        size_t length{0};
+        char32_t c{0};
+        if (lead < 0x80)
+        {
+            ++index;
+            return lead;
+        }
+        if ((lead & 0xE0) == 0xC0)
+        {
+            length = 2;
+            c = lead & 0x1F;
+        }
+        else if ((lead & 0xF0) == 0xE0)
+        {
+            length = 3;
+            c = lead & 0x0F;
+        }
+        else if ((lead & 0xF8) == 0xF0)
+        {
+            length = 4;
+            c = lead & 0x07;
+        }
+        if (length == 0 || index + length > text.size())
+        {
+            ++index;
+            return 0x110000 + lead;
+        }
+        for (size_t offset{1}; offset < length; ++offset)
+        {
+            if ((unit(index + offset) & 0xC0) != 0x80)
+            {
+                ++index;
+                return 0x110000 + lead;
+            }
+            c = (c << 6) | (unit(index + offset) & 0x3F);
+        }
+        index += length;
+        return c;
+    }
+}
+
+/**
+ * @brief Hash and length of a case-folded name.
+ */
+struct FoldedKey
+{
+    uint64_t hash{14695981039346656037ULL}; ///< FNV-1a hash over the folded code points.
+    size_t length{0};                       ///< The number of code points.
+    bool ascii{true};                       ///< Whether the name only contains ASCII bytes.
+
+    constexpr void append(char32_t c)
+    {
+        hash = (hash ^ static_cast<uint64_t>(c)) * 1099511628211ULL;
+        ++length;
+    }
+};
+
+/**
+ * @brief Computes the folded key of a name.
+ *
+ * @param name The name to fold.
+ * @param ascii Whether the name is known to be pure ASCII, which skips decoding.
+ * @return The folded key.
+ */
+template<typename CharT>
+constexpr FoldedKey foldKey(std::basic_string_view<CharT> name, bool ascii)
+{
+    FoldedKey key{};
+    key.ascii = ascii;
+    if (ascii)
+    {
+        for (const CharT c : name)
+        {
+            key.append(foldCodePoint(static_cast<char32_t>(c)));
+        }
+        return key;
+    }
+    for (size_t index{0}; index < name.size();)
+    {
+        key.append(foldCodePoint(decodeCodePoint(name, index)));
+    }
+    return key;
+}
+
+/**
+ * @brief Compares two names after case folding.
+ *
+ * @param lhs The first name.
+ * @param rhs The second name.
+ * @param ascii Whether both names are known to be pure ASCII.
+ * @return `true` if the folded names are equal, otherwise `false`.
+ */
+template<typename CharT>
+constexpr bool foldedEqual(std::basic_string_view<CharT> lhs, std::basic_string_view<CharT> rhs, bool ascii)
+{
+    if (ascii)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+        for (size_t index{0}; index < lhs.size(); ++index)
+        {
+            if (foldCodePoint(static_cast<char32_t>(lhs[index])) != foldCodePoint(static_cast<char32_t>(rhs[index])))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    size_t left{0};
+    size_t right{0};
+    while (left < lhs.size() && right < rhs.size())
+    {
+        if (foldCodePoint(decodeCodePoint(lhs, left)) != foldCodePoint(decodeCodePoint(rhs, right)))
+        {
+            return false;
+        }
+    }
+    return left == lhs.size() && right == rhs.size();
+}
+} // namespace detail
+
+namespace policy
+{
+// UnicodeCaseInsensitiveStringSearchPolicy definition
+/**
+ * @brief Search policy that compares names after Unicode simple case folding.
+ *
+ * Names are decoded as UTF-8, UTF-16 or UTF-32 depending on the width of the character type.
+ * The holder precomputes the folded hash of every name at compile time. A query is checked for
+ * non-ASCII units with SIMD first; pure-ASCII queries are folded unit by unit and only names with
+ * non-ASCII units pay for decoding.
+ */
+struct UnicodeCaseInsensitiveStringSearchPolicy
+{
+    /**
+     * @brief Folded keys of the entries of a holder.
+     */
+    template<typename T, size_t N, typename CharT>
+    class Index
+    {
+    public:
+        constexpr explicit Index(const std::array<Enum<T, CharT>, N>& entries)
+        {
+            for (size_t index{0}; index < N; ++index)
+            {
+                m_keys[index] = detail::foldKey(entries[index].name, detail::isAscii(entries[index].name));
+            }
+        }
+
+        /**
+         * @brief Searches for an Enum entry by name using the precomputed folded keys.
+         *
+         * @param name The name to search for.
+         * @param entries The array of Enum entries.
+         * @return The corresponding Enum entry.
+         */
+        constexpr Enum<T, CharT> search(std::basic_string_view<CharT> name, const std::array<Enum<T, CharT>, N>& entries) const
+        {
+            const detail::FoldedKey query{detail::foldKey(name, detail::isAscii(name))};
+            for (size_t index{0}; index < N; ++index)
+            {
+                if (m_keys[index].hash == query.hash && m_keys[index].length == query.length &&
+                    detail::foldedEqual(entries[index].name, name, query.ascii && m_keys[index].ascii))
+                {
+                    return entries[index];
+                }
+            }
+            return default_unknown_enum<T, CharT>();
+        }
+
+    private:
+        std::array<detail::FoldedKey, N> m_keys{}; ///< Folded key of each entry.
+    };
+
+    /**
+     * @brief Searches for an Enum entry by name without precomputed keys.
+     *
+     * @param name The name to search for.
+     * @param entries The array of Enum entries.
+     * @return The corresponding Enum entry.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr Enum<T, CharT> search(detail::TypeIdentityT<std::basic_string_view<CharT>> name, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        const bool ascii{detail::isAscii(name)};
+        for (const auto& entry : entries)
+        {
+            if (detail::foldedEqual(entry.name, name, ascii && detail::isAscii(entry.name)))
+            {
+                return entry;
+            }
+        }
+        return default_unknown_enum<T, CharT>();
+    }
+};
+} // namespace policy
+} // namespace trlc
\ No newline at end of file
@@ -0,0 +1,217 @@
+#pragma once
+#if !defined(__linux__)
+#error "EnumDictionaryWatcher requires Linux inotify"
+#endif
+
+#include "runtime.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace trlc
+{
+
+/**
+ * @brief Counters published by an `EnumDictionaryWatcher`.
+ */
+struct EnumWatcherMetrics
+{
+    std::atomic<uint64_t> reloads{0};         ///< Number of successfully published rebuilds.
+    std::atomic<uint64_t> failures{0};        ///< Number of rebuilds rejected because the file was unreadable or malformed, plus a watch error that stopped the watch thread.
+    std::atomic<uint64_t> lastRebuildNanos{0}; ///< Duration of the last rebuild (parse and index build).
+    std::atomic<uint64_t> maxRebuildNanos{0};  ///< Longest rebuild observed.
+    std::atomic<uint64_t> lastSwapNanos{0};    ///< Duration of the last publication of a rebuilt holder.
+    std::atomic<uint64_t> maxSwapNanos{0};     ///< Longest publication observed.
+};
+
+/**
+ * @brief Watches a dictionary file and republishes its `RuntimeEnumHolder` whenever the file changes.
+ *
+ * The holder is rebuilt on a background thread and swapped in atomically, so `current()` never blocks
+ * on a rebuild. Readers keep the holder (and the names it returned) alive by holding the pointer.
+ * A rebuild that fails keeps the previous holder published.
+ *
+ * @tparam T The type of the enum value.
+ * @tparam UnknownPolicy The policy for handling unknown enums.
+ */
+template<typename T, class UnknownPolicy = policy::UnknownPolicy>
+class EnumDictionaryWatcher
+{
+public:
+    using Holder = RuntimeEnumHolder<T, UnknownPolicy>;
+    using HolderPtr = typename Holder::Ptr;
+
+    UNCOPYABLE(EnumDictionaryWatcher)
+
+    /**
+     * @brief Loads the dictionary once and starts watching it.
+     *
+     * @param path The path of the dictionary file.
+     */
+    explicit EnumDictionaryWatcher(std::string path)
+        : m_path(std::move(path))
+    {
+        const size_t separator{m_path.find_last_of('/')};
+        m_directory = separator == std::string::npos ? std::string{"."} : m_path.substr(0, separator + 1);
+        m_fileName = separator == std::string::npos ? m_path : m_path.substr(separator + 1);
+
+        m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        m_stopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        // Watch the directory rather than the file so editors that replace the file by rename are seen too.
+        const bool watched{m_inotifyFd >= 0 && m_stopFd >= 0 && inotify_add_watch(m_inotifyFd, m_directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) >= 0};
+        // Load after the watch is in place so a file replaced in between still triggers a rebuild.
+        reload();
+        if (watched)
+        {
+            m_watching.store(true, std::memory_order_relaxed);
+            m_thread = std::thread([this]() { watch(); });
+        }
+    }
+
+    ~EnumDictionaryWatcher()
+    {
+        if (m_thread.joinable())
+        {
+            const uint64_t stop{1};
+            [[maybe_unused]] const ssize_t written{write(m_stopFd, &stop, sizeof(stop))};
+            m_thread.join();
+        }
+        if (m_inotifyFd >= 0)
+        {
+            close(m_inotifyFd);
+        }
+        if (m_stopFd >= 0)
+        {
+            close(m_stopFd);
+        }
+    }
+
+    /**
+     * @brief Returns the currently published holder, or an empty pointer if no load has succeeded yet.
+     */
+    HolderPtr current() const
+    {
+        return m_current.load();
+    }
+
+    /**
+     * @brief Returns whether the background thread is watching the file.
+     */
+    bool watching() const
+    {
+        return m_watching.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the rebuild and swap metrics.
+     */
+    const EnumWatcherMetrics& metrics() const
+    {
+        return m_metrics;
+    }
+
+    /**
+     * @brief Rebuilds the holder from the file and publishes it.
+     *
+     * @return `true` if a new holder was published, otherwise `false`.
+     */
+    bool reload()
+    {
+        const auto rebuildStart{std::chrono::steady_clock::now()};
+        HolderPtr holder{Holder::fromFile(m_path)};
+        if (!holder)
+        {
+            m_metrics.failures.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        // Readers of a published holder never wait for a lazy index build.
+        holder->warmUp();
+        const auto rebuildEnd{std::chrono::steady_clock::now()};
+
+        HolderPtr previous{m_current.exchange(std::move(holder))};
+        const auto swapEnd{std::chrono::steady_clock::now()};
+        // The previous holder is released after timing so its destruction is not counted as swap latency.
+        previous.reset();
+
+        record(m_metrics.lastRebuildNanos, m_metrics.maxRebuildNanos, rebuildEnd - rebuildStart);
+        record(m_metrics.lastSwapNanos, m_metrics.maxSwapNanos, swapEnd - rebuildEnd);
+        m_metrics.reloads.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static void record(std::atomic<uint64_t>& last, std::atomic<uint64_t>& max, std::chrono::steady_clock::duration elapsed)
+    {
+        const uint64_t nanos{static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())};
+        last.store(nanos, std::memory_order_relaxed);
+        uint64_t observed{max.load(std::memory_order_relaxed)};
+        while (observed < nanos && !max.compare_exchange_weak(observed, nanos, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void watch()
+    {
+        pollfd fds[2]{{m_inotifyFd, POLLIN, 0}, {m_stopFd, POLLIN, 0}};
+        alignas(inotify_event) char buffer[4096];
+        while (true)
+        {
+            if (poll(fds, 2, -1) < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                // A persistent error would spin; stop watching and keep the last holder published.
+                m_metrics.failures.fetch_add(1, std::memory_order_relaxed);
+                m_watching.store(false, std::memory_order_relaxed);
+                return;
+            }
+            if (fds[1].revents & POLLIN)
+            {
+                return;
+            }
+
+            // Drain every pending event first so a burst of writes causes a single rebuild.
+            bool changed{false};
+            ssize_t length{0};
+            while ((length = read(m_inotifyFd, buffer, sizeof(buffer))) > 0)
+            {
+                for (char* cursor{buffer}; cursor < buffer + length;)
+                {
+                    const auto* event{reinterpret_cast<const inotify_event*>(cursor)};
+                    if (event->len > 0 && m_fileName == event->name)
+                    {
+                        changed = true;
+                    }
+                    cursor += sizeof(inotify_event) + event->len;
+                }
+            }
+            if (changed)
+            {
+                reload();
+            }
+        }
+    }
+
+    std::string m_path;                             ///< The watched dictionary file.
+    std::string m_directory;                        ///< The directory holding the file.
+    std::string m_fileName;                         ///< The file name inside the directory.
+    detail::AtomicSharedPtr<const Holder> m_current; ///< The published holder.
+    EnumWatcherMetrics m_metrics;                   ///< Rebuild and swap metrics.
+    int m_inotifyFd{-1};                            ///< The inotify instance.
+    int m_stopFd{-1};                               ///< Signals the watch thread to stop.
+    std::atomic<bool> m_watching{false};            ///< Whether the watch thread is running.
+    std::thread m_thread;                           ///< The background rebuild thread.
+};
+
+} // namespace trlc
\ No newline at end of file
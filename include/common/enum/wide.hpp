@@ -0,0 +1,261 @@
+#pragma once
+#include "detail.hpp"
+#include "simd.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace trlc
+{
+#if defined(__SIZEOF_INT128__)
+/// The compiler's 128-bit unsigned integer; `__extension__` keeps `-Wpedantic` quiet about it.
+__extension__ typedef unsigned __int128 Uint128;
+#endif
+
+namespace detail
+{
+/**
+ * @brief Describes an enum value wider than 64 bits as little-endian 64-bit words.
+ *
+ * Specialized for `Uint128` and `std::array<std::byte, K>`.
+ */
+template<typename T>
+struct WideKey;
+
+#if defined(__SIZEOF_INT128__)
+template<>
+struct WideKey<Uint128>
+{
+    static constexpr size_t kWords{2};
+
+    static constexpr uint64_t word(const Uint128& key, size_t index)
+    {
+        return static_cast<uint64_t>(key >> (64 * index));
+    }
+};
+#endif
+
+template<size_t K>
+struct WideKey<std::array<std::byte, K>>
+{
+    static constexpr size_t kWords{(K + 7) / 8};
+
+    static constexpr uint64_t word(const std::array<std::byte, K>& key, size_t index)
+    {
+        uint64_t result{0};
+        for (size_t byte{0}; byte < 8 && index * 8 + byte < K; ++byte)
+        {
+            result |= std::to_integer<uint64_t>(key[index * 8 + byte]) << (8 * byte);
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Multiplies two words into 128 bits and folds the halves together.
+ */
+constexpr uint64_t foldedMultiply(uint64_t lhs, uint64_t rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    const Uint128 product{static_cast<Uint128>(lhs) * rhs};
+    return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+    const uint64_t lowLow{(lhs & 0xFFFFFFFFu) * (rhs & 0xFFFFFFFFu)};
+    const uint64_t highLow{(lhs >> 32) * (rhs & 0xFFFFFFFFu)};
+    const uint64_t lowHigh{(lhs & 0xFFFFFFFFu) * (rhs >> 32)};
+    const uint64_t highHigh{(lhs >> 32) * (rhs >> 32)};
+    const uint64_t middle{(lowLow >> 32) + (highLow & 0xFFFFFFFFu) + lowHigh};
+    return ((middle << 32) | (lowLow & 0xFFFFFFFFu)) ^ (highHigh + (highLow >> 32) + (middle >> 32));
+#endif
+}
+
+/**
+ * @brief Hashes a wide key two words at a time with folded 128-bit multiplies.
+ */
+template<typename T>
+constexpr uint64_t hashWideKey(const T& key)
+{
+    constexpr size_t kWords{WideKey<T>::kWords};
+    uint64_t hash{kWords};
+    for (size_t index{0}; index < kWords; index += 2)
+    {
+        const uint64_t high{index + 1 < kWords ? WideKey<T>::word(key, index + 1) : 0};
+        hash = foldedMultiply(WideKey<T>::word(key, index) ^ 0xa0761d6478bd642fULL ^ hash, high ^ 0xe7037ed1a0b428dbULL);
+    }
+    return foldedMultiply(hash ^ 0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL);
+}
+
+/**
+ * @brief Compares two wide keys, with one 32-byte or a few 16-byte vector compares at runtime.
+ */
+template<typename T>
+constexpr bool wideEqual(const T& lhs, const T& rhs)
+{
+#if defined(TRLC_ENUM_HAS_SSE2)
+    if (!isConstantEvaluated())
+    {
+        const auto* left{reinterpret_cast<const unsigned char*>(&lhs)};
+        const auto* right{reinterpret_cast<const unsigned char*>(&rhs)};
+#if defined(__AVX2__)
+        if constexpr (sizeof(T) == 32)
+        {
+            const __m256i equal{_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(left)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right)))};
+            return _mm256_movemask_epi8(equal) == -1;
+        }
+#endif
+        if constexpr (sizeof(T) % 16 == 0)
+        {
+            __m128i equal{_mm_set1_epi8(-1)};
+            for (size_t offset{0}; offset < sizeof(T); offset += 16)
+            {
+                const __m128i lane{_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(left + offset)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + offset)))};
+                equal = _mm_and_si128(equal, lane);
+            }
+            return _mm_movemask_epi8(equal) == 0xFFFF;
+        }
+        else
+        {
+            return std::memcmp(left, right, sizeof(T)) == 0;
+        }
+    }
+#endif
+    for (size_t index{0}; index < WideKey<T>::kWords; ++index)
+    {
+        if (WideKey<T>::word(lhs, index) != WideKey<T>::word(rhs, index))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace detail
+
+namespace policy
+{
+// WideKeySearchPolicy definition
+/**
+ * @brief Search policy for values wider than 64 bits: `Uint128` and `std::array<std::byte, K>`.
+ *
+ * The holder builds an open-addressing table of the entries at compile time, hashed with folded
+ * 128-bit multiplies. A lookup hashes the value once and usually confirms the first slot with a
+ * single vector compare (`pcmpeqb`, or `vpcmpeqb` for 32-byte keys with AVX2), so it costs about
+ * as much as a hashed lookup of a 64-bit value.
+ */
+struct WideKeySearchPolicy
+{
+    /**
+     * @brief Hash table of the entries, at most half full.
+     */
+    template<typename T, size_t N, typename CharT>
+    class Index
+    {
+    public:
+        constexpr explicit Index(const std::array<Enum<T, CharT>, N>& entries)
+        {
+            for (auto& slot : m_slots)
+            {
+                slot = N;
+            }
+            for (size_t index{0}; index < N; ++index)
+            {
+                size_t slot{detail::hashWideKey(entries[index].value) & (kSlots - 1)};
+                // A repeated value keeps its first entry, like the linear policies.
+                while (m_slots[slot] != N && !detail::wideEqual(entries[m_slots[slot]].value, entries[index].value))
+                {
+                    slot = (slot + 1) & (kSlots - 1);
+                }
+                if (m_slots[slot] == N)
+                {
+                    m_slots[slot] = index;
+                }
+            }
+        }
+
+        /**
+         * @brief Finds the slot of the entry holding a value.
+         *
+         * @param value The value to search for.
+         * @param entries The array of Enum entries.
+         * @return The slot of the entry, or `N` if no entry holds the value.
+         */
+        constexpr size_t find(const T& value, const std::array<Enum<T, CharT>, N>& entries) const
+        {
+            for (size_t slot{detail::hashWideKey(value) & (kSlots - 1)};; slot = (slot + 1) & (kSlots - 1))
+            {
+                const size_t index{m_slots[slot]};
+                if (index == N || detail::wideEqual(entries[index].value, value))
+                {
+                    return index;
+                }
+            }
+        }
+
+        /**
+         * @brief Searches for an Enum entry by value.
+         *
+         * @param value The value to search for.
+         * @param entries The array of Enum entries.
+         * @return The corresponding Enum entry.
+         */
+        constexpr Enum<T, CharT> search(const T& value, const std::array<Enum<T, CharT>, N>& entries) const
+        {
+            const size_t index{find(value, entries)};
+            return index < N ? entries[index] : default_unknown_enum<T, CharT>();
+        }
+
+    private:
+        static constexpr size_t kSlots{[]() {
+            size_t slots{2};
+            while (slots < 2 * N)
+            {
+                slots *= 2;
+            }
+            return slots;
+        }()};
+
+        std::array<size_t, kSlots> m_slots{}; ///< Entry index of each slot, `N` when empty.
+    };
+
+    /**
+     * @brief Finds the slot of the first entry holding a value without the hash table.
+     *
+     * @param value The value to search for.
+     * @param entries The array of Enum entries.
+     * @return The slot of the entry, or `N` if no entry holds the value.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr size_t find(const T& value, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        for (size_t index{0}; index < N; ++index)
+        {
+            if (detail::wideEqual(entries[index].value, value))
+            {
+                return index;
+            }
+        }
+        return N;
+    }
+
+    /**
+     * @brief Searches for an Enum entry by value without the hash table.
+     *
+     * @param value The value to search for.
+     * @param entries The array of Enum entries.
+     * @return The corresponding Enum entry.
+     */
+    template<typename T, size_t N, typename CharT>
+    static constexpr Enum<T, CharT> search(const T& value, const std::array<Enum<T, CharT>, N>& entries)
+    {
+        const size_t index{find(value, entries)};
+        return index < N ? entries[index] : default_unknown_enum<T, CharT>();
+    }
+};
+} // namespace policy
+
+} // namespace trlc
\ No newline at end of file
@@ -0,0 +1,10 @@
+# Fails when an object file contains dynamic initializers, i.e. code that runs at startup.
+# Usage: cmake -DNM=<nm> -DOBJECTS=<objects> -P check_static_init.cmake
+execute_process(COMMAND ${NM} ${OBJECTS} OUTPUT_VARIABLE SYMBOLS RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${OBJECTS}")
+endif()
+if(SYMBOLS MATCHES "_GLOBAL__sub_I|__cxx_global_var_init|_GLOBAL__I_")
+    message(FATAL_ERROR "Dynamic initializers found in ${OBJECTS}:\n${SYMBOLS}")
+endif()
+message(STATUS "No dynamic initializers in ${OBJECTS}")
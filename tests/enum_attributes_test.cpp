@@ -0,0 +1,71 @@
+#include "common/enum.hpp"
+#include "common/enum/attributes.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string_view>
+
+namespace Policy = trlc::policy;
+
+namespace
+{
+enum class Failure
+{
+    Unknown = 0,
+    Timeout = 1,
+    Refused = 2,
+    Corrupt = 3
+};
+
+enum class Severity
+{
+    None = 0,
+    Low = 1,
+    High = 2
+};
+
+constexpr std::array<trlc::Enum<Failure>, 3> kFailures = {{{Failure::Timeout, "Timeout"}, {Failure::Refused, "Refused"}, {Failure::Corrupt, "Corrupt"}}};
+constexpr std::array<std::string_view, 3> kDescriptions = {"The peer did not answer in time", "The peer refused the connection", "The payload failed its checksum"};
+constexpr std::array<Severity, 3> kSeverities = {Severity::Low, Severity::Low, Severity::High};
+constexpr std::array<bool, 3> kRetry = {true, true, false};
+
+using FailureHolder = trlc::EnumHolder<Failure, kFailures.size(), Policy::SortedSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy>;
+constexpr trlc::AttributedEnumHolder<FailureHolder, std::string_view, Severity, bool> kHolder{kFailures, kDescriptions, kSeverities, kRetry};
+
+enum Column
+{
+    Description = 0,
+    SeverityColumn = 1,
+    Retry = 2
+};
+} // namespace
+
+TEST(AttributedEnumHolderTest, AttributesByIndexValueAndName)
+{
+    static_assert(kHolder.attributeFromValue<SeverityColumn>(Failure::Corrupt) == Severity::High);
+    static_assert(kHolder.attributeFromString<Retry>("Refused"));
+
+    const size_t index{kHolder.indexFromValue(Failure::Timeout)};
+    EXPECT_EQ(kHolder.attribute<Description>(index), "The peer did not answer in time");
+    EXPECT_TRUE(kHolder.attribute<Retry>(index));
+    EXPECT_FALSE(kHolder.attributeFromValue<Retry>(Failure::Corrupt));
+    EXPECT_EQ(kHolder.attributeFromString<SeverityColumn>("Refused"), Severity::Low);
+    EXPECT_EQ(&kHolder.column<SeverityColumn>(), &kSeverities);
+
+    // The holder keeps its lookups.
+    EXPECT_EQ(kHolder.fromValue(Failure::Refused).name, "Refused");
+    EXPECT_EQ(kHolder.fromString("Corrupt").value, Failure::Corrupt);
+}
+
+TEST(AttributedEnumHolderTest, UnknownEntriesReadDefaults)
+{
+    EXPECT_EQ(kHolder.attributeFromValue<Description>(Failure::Unknown), "");
+    EXPECT_EQ(kHolder.attributeFromString<SeverityColumn>("Missing"), Severity::None);
+    EXPECT_FALSE(kHolder.attribute<Retry>(kFailures.size()));
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
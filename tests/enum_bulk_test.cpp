@@ -0,0 +1,163 @@
+#include "common/enum.hpp"
+#include "common/enum/bulk.hpp"
+#include "common/enum/runtime.hpp"
+
+#include <array>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+enum class Level
+{
+    Unknown = 0,
+    Debug = 1,
+    Info = 2,
+    Warn = 3,
+    Error = 4
+};
+
+constexpr std::array<trlc::Enum<Level>, 5> levelEntries = {{{Level::Unknown, "Unknown"},
+                                                            {Level::Debug, "Debug"},
+                                                            {Level::Info, "Info"},
+                                                            {Level::Warn, "Warn"},
+                                                            {Level::Error, "Error"}}};
+
+namespace Policy = trlc::policy;
+using LevelHolder = trlc::EnumHolder<Level, levelEntries.size(), Policy::SortedSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy>;
+
+std::vector<Level> makeColumn(size_t rows)
+{
+    std::vector<Level> column(rows);
+    for (size_t row{0}; row < rows; ++row)
+    {
+        column[row] = static_cast<Level>(row % 6); // 5 is not an entry
+    }
+    return column;
+}
+} // namespace
+
+TEST(BulkConversionTest, ValuesToNamesMatchesSingleLookups)
+{
+    const LevelHolder holder{levelEntries};
+    const std::vector<Level> values{makeColumn(300000)};
+    std::vector<std::string_view> names(values.size());
+
+    trlc::valuesToNames(holder, values.data(), values.size(), names.data(), 4);
+
+    for (size_t row{0}; row < values.size(); ++row)
+    {
+        ASSERT_EQ(names[row], holder.fromValue(values[row]).name) << "row " << row;
+    }
+}
+
+TEST(BulkConversionTest, NamesToValuesRoundTrip)
+{
+    const LevelHolder holder{levelEntries};
+    const std::vector<Level> values{makeColumn(300000)};
+    std::vector<std::string_view> names(values.size());
+    std::vector<Level> parsed(values.size());
+
+    trlc::valuesToNames(holder, values.data(), values.size(), names.data(), 3);
+    trlc::namesToValues(holder, names.data(), names.size(), parsed.data(), 3);
+
+    for (size_t row{0}; row < values.size(); ++row)
+    {
+        ASSERT_EQ(parsed[row], static_cast<size_t>(values[row]) == 5 ? Level::Unknown : values[row]) << "row " << row;
+    }
+}
+
+TEST(BulkConversionTest, SmallInputAndRuntimeHolder)
+{
+    const trlc::RuntimeEnumHolder<Level> holder{{{Level::Info, "Info"}, {Level::Error, "Error"}}};
+    const std::array<std::string_view, 3> names{"Error", "Info", "Missing"};
+    std::array<Level, 3> values{};
+
+    trlc::namesToValues(holder, names.data(), names.size(), values.data());
+
+    EXPECT_EQ(values[0], Level::Error);
+    EXPECT_EQ(values[1], Level::Info);
+    EXPECT_EQ(values[2], Level::Unknown);
+
+    trlc::namesToValues(holder, names.data(), 0, values.data());
+}
+
+TEST(BulkConversionTest, WorkerExceptionReachesCaller)
+{
+    // Throws for one row, deep inside a chunk that a pool thread will likely take.
+    struct ThrowingHolder
+    {
+        trlc::Enum<Level> fromValue(Level value) const
+        {
+            if (static_cast<int>(value) == 7)
+            {
+                throw std::runtime_error{"bad row"};
+            }
+            return {value, "Row"};
+        }
+    };
+
+    std::vector<Level> values(200000, Level::Info);
+    values[150000] = static_cast<Level>(7);
+    std::vector<std::string_view> names(values.size());
+    EXPECT_THROW(trlc::valuesToNames(ThrowingHolder{}, values.data(), values.size(), names.data(), 4), std::runtime_error);
+
+    // The pool keeps working after a failed call, and nested calls from pool threads complete.
+    values[150000] = Level::Info;
+    const LevelHolder holder{levelEntries};
+    trlc::valuesToNames(holder, values.data(), values.size(), names.data(), 4);
+    EXPECT_EQ(names[150000], "Info");
+
+    std::vector<std::vector<std::string_view>> inner(4, std::vector<std::string_view>(100000));
+    trlc::detail::parallelChunks(inner.size(), 1 << 20, 4, [&](size_t first, size_t) { trlc::valuesToNames(holder, values.data(), inner[first].size(), inner[first].data(), 2); });
+    for (const auto& column : inner)
+    {
+        EXPECT_EQ(column.back(), "Info");
+    }
+}
+
+TEST(BulkConversionTest, ConcurrentCallersShareThePool)
+{
+    // Chunks that wait rather than compute show the overlap on any number of cores.
+    constexpr size_t kChunks{32};
+    constexpr auto kChunkTime{std::chrono::milliseconds(5)};
+    std::array<std::set<std::thread::id>, 2> workers;
+    std::mutex mutex;
+
+    const auto start{std::chrono::steady_clock::now()};
+    std::array<std::thread, 2> callers;
+    for (size_t caller{0}; caller < callers.size(); ++caller)
+    {
+        callers[caller] = std::thread{[&, caller]() {
+            trlc::detail::parallelChunks(kChunks, trlc::detail::kBulkChunkBytes, 4, [&](size_t, size_t) {
+                std::this_thread::sleep_for(kChunkTime);
+                std::lock_guard<std::mutex> lock{mutex};
+                workers[caller].insert(std::this_thread::get_id());
+            });
+        }};
+    }
+    for (auto& caller : callers)
+    {
+        caller.join();
+    }
+    const auto elapsed{std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start)};
+
+    // Either call alone on one thread would take all 32 chunk times; sharing four threads takes about 14.
+    EXPECT_LT(elapsed.count(), (kChunkTime * kChunks).count());
+    for (const auto& threads : workers)
+    {
+        EXPECT_GT(threads.size(), 1u);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#include "enum_constinit_tables.hpp"
+
+namespace constinit_tables
+{
+TRLC_CONSTINIT_ENUM const Colors kColors{{{Color::Red, "Red"}, {Color::Green, "Green"}, {Color::Blue, "Blue"}}};
+TRLC_CONSTINIT_ENUM const WideColors kWideColors{{{Color::Red, u"Red"}, {Color::Green, u"Green"}, {Color::Blue, u"Blue"}}};
+
+TRLC_CONSTINIT_ENUM const LinearHolder kLinear{kColors};
+TRLC_CONSTINIT_ENUM const SortedHolder kSorted{kColors};
+TRLC_CONSTINIT_ENUM const InterpolationHolder kInterpolation{kColors};
+TRLC_CONSTINIT_ENUM const SimdHolder kSimd{kColors};
+TRLC_CONSTINIT_ENUM const PackedHolder kPacked{kColors};
+TRLC_CONSTINIT_ENUM const WideHolder kWide{kWideColors};
+
+// Built from a constexpr holder; the holders above are not usable in constant expressions.
+constexpr Colors kConstexprColors{{{Color::Red, "Red"}, {Color::Green, "Green"}, {Color::Blue, "Blue"}}};
+constexpr LinearHolder kConstexprHolder{kConstexprColors};
+TRLC_CONSTINIT_ENUM const trlc::EnumSet<3> kWarm{trlc::selectGlob(kConstexprHolder, "[GR]*")};
+} // namespace constinit_tables
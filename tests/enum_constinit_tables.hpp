@@ -0,0 +1,40 @@
+#pragma once
+#include "common/enum.hpp"
+#include "common/enum/set.hpp"
+
+#include <array>
+#include <cstdint>
+
+// Tables and holders defined with TRLC_CONSTINIT_ENUM in enum_constinit_tables.cpp. The object file
+// of that translation unit is checked for dynamic initializers by the enum_constinit_static_init test.
+namespace constinit_tables
+{
+enum class Color : uint8_t
+{
+    Unknown = 0,
+    Red = 1,
+    Green = 2,
+    Blue = 3
+};
+
+using Colors = std::array<trlc::Enum<Color>, 3>;
+using WideColors = std::array<trlc::Enum<Color, char16_t>, 3>;
+
+using LinearHolder = trlc::EnumHolder<Color, 3, trlc::policy::LinearSearchPolicy, trlc::policy::CaseSensitiveStringSearchPolicy, trlc::policy::UnknownPolicy>;
+using SortedHolder = trlc::EnumHolder<Color, 3, trlc::policy::SortedSearchPolicy, trlc::policy::CaseInsensitiveStringSearchPolicy, trlc::policy::UnknownPolicy>;
+using InterpolationHolder =
+    trlc::EnumHolder<Color, 3, trlc::policy::InterpolationSearchPolicy, trlc::policy::UnicodeCaseInsensitiveStringSearchPolicy, trlc::policy::UnknownPolicy>;
+using SimdHolder = trlc::EnumHolder<Color, 3, trlc::policy::LinearSearchPolicy, trlc::policy::SimdStringSearchPolicy, trlc::policy::UnknownPolicy>;
+using PackedHolder = trlc::EnumHolder<Color, 3, trlc::policy::LinearSearchPolicy, trlc::policy::PackedKeyStringSearchPolicy, trlc::policy::UnknownPolicy>;
+using WideHolder = trlc::EnumHolder<Color, 3, trlc::policy::LinearSearchPolicy, trlc::policy::CaseSensitiveStringSearchPolicy, trlc::policy::UnknownPolicy, char16_t>;
+
+extern const Colors kColors;
+extern const WideColors kWideColors;
+extern const LinearHolder kLinear;
+extern const SortedHolder kSorted;
+extern const InterpolationHolder kInterpolation;
+extern const SimdHolder kSimd;
+extern const PackedHolder kPacked;
+extern const WideHolder kWide;
+extern const trlc::EnumSet<3> kWarm;
+} // namespace constinit_tables
@@ -0,0 +1,26 @@
+#include "enum_constinit_tables.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace constinit_tables;
+
+TEST(EnumConstinitTest, HoldersAreUsableWithoutStartupWork)
+{
+    EXPECT_EQ(kLinear.fromValue(Color::Green).name, "Green");
+    EXPECT_EQ(kLinear.fromString("Blue").value, Color::Blue);
+    EXPECT_EQ(kSorted.fromString("rEd").value, Color::Red);
+    EXPECT_EQ(kInterpolation.fromValue(Color::Blue).name, "Blue");
+    EXPECT_EQ(kInterpolation.fromString("GREEN").value, Color::Green);
+    EXPECT_EQ(kSimd.fromString("Green").value, Color::Green);
+    EXPECT_EQ(kPacked.fromString("Red").value, Color::Red);
+    EXPECT_EQ(kWide.fromString(u"Blue").value, Color::Blue);
+    EXPECT_EQ(kLinear.fromString("Purple").value, Color::Unknown);
+    EXPECT_TRUE(kWarm.test(kLinear.indexFromValue(Color::Red)));
+    EXPECT_FALSE(kWarm.test(kLinear.indexFromValue(Color::Blue)));
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+#include "common/enum.hpp"
+#include "common/enum/event_bus.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace Policy = trlc::policy;
+
+namespace
+{
+enum class Message
+{
+    Unknown = 0,
+    Order = 1,
+    Quote = 2,
+    Trade = 3
+};
+
+constexpr std::array<trlc::Enum<Message>, 3> kMessages = {{{Message::Order, "Order"}, {Message::Quote, "Quote"}, {Message::Trade, "Trade"}}};
+constexpr trlc::EnumHolder<Message, kMessages.size(), Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> kHolder{kMessages};
+
+struct Event
+{
+    uint32_t producer{0};
+    uint32_t sequence{0};
+};
+} // namespace
+
+TEST(EventBusTest, PublishAndDrainPerType)
+{
+    trlc::EventBus<decltype(kHolder), int, 1, 4> bus{kHolder};
+
+    EXPECT_TRUE(bus.publish(0, Message::Order, 1));
+    EXPECT_TRUE(bus.publish(0, Message::Quote, 2));
+    EXPECT_TRUE(bus.publish(0, Message::Order, 3));
+    EXPECT_FALSE(bus.publish(0, Message::Unknown, 4));
+    EXPECT_FALSE(bus.publish(1, Message::Order, 5));
+    EXPECT_EQ(bus.pending(Message::Order), 2u);
+
+    std::vector<int> orders;
+    EXPECT_EQ(bus.drain(Message::Order, [&orders](int&& event) { orders.push_back(event); }), 2u);
+    EXPECT_EQ(orders, (std::vector<int>{1, 3}));
+    EXPECT_EQ(bus.pending(Message::Quote), 1u);
+    EXPECT_EQ(bus.drain(Message::Trade, [](int&&) {}), 0u);
+    EXPECT_EQ(bus.drain(Message::Unknown, [](int&&) {}), 0u);
+}
+
+TEST(EventBusTest, FullRingAndBatchLimit)
+{
+    trlc::EventBus<decltype(kHolder), int, 1, 4> bus{kHolder};
+    for (int event{0}; event < 4; ++event)
+    {
+        EXPECT_TRUE(bus.publish(0, Message::Trade, event));
+    }
+    EXPECT_FALSE(bus.publish(0, Message::Trade, 4));
+    // Other types are unaffected by a full lane.
+    EXPECT_TRUE(bus.publish(0, Message::Quote, 4));
+
+    std::vector<int> trades;
+    EXPECT_EQ(bus.drain(Message::Trade, [&trades](int&& event) { trades.push_back(event); }, 3), 3u);
+    EXPECT_TRUE(bus.publish(0, Message::Trade, 5));
+    EXPECT_EQ(bus.drain(Message::Trade, [&trades](int&& event) { trades.push_back(event); }), 2u);
+    EXPECT_EQ(trades, (std::vector<int>{0, 1, 2, 3, 5}));
+}
+
+TEST(EventBusTest, ConcurrentProducersAndConsumers)
+{
+    constexpr size_t kProducers{2};
+    constexpr uint32_t kEvents{20000};
+    trlc::EventBus<decltype(kHolder), Event, kProducers, 256> bus{kHolder};
+
+    std::vector<std::thread> producers;
+    for (uint32_t producer{0}; producer < kProducers; ++producer)
+    {
+        producers.emplace_back([&bus, producer]() {
+            for (uint32_t sequence{0}; sequence < kEvents; ++sequence)
+            {
+                const Message type{kMessages[sequence % kMessages.size()].value};
+                while (!bus.publish(producer, type, Event{producer, sequence}))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::array<size_t, kMessages.size()> received{};
+    std::array<bool, kMessages.size()> ordered{true, true, true};
+    std::vector<std::thread> consumers;
+    for (size_t lane{0}; lane < kMessages.size(); ++lane)
+    {
+        consumers.emplace_back([&, lane]() {
+            std::array<int64_t, kProducers> last{-1, -1};
+            const size_t expected{kProducers * ((kEvents - lane + kMessages.size() - 1) / kMessages.size())};
+            while (received[lane] < expected)
+            {
+                const size_t count{bus.drain(kMessages[lane].value, [&](Event&& event) {
+                    ordered[lane] = ordered[lane] && static_cast<int64_t>(event.sequence) > last[event.producer] && event.sequence % kMessages.size() == lane;
+                    last[event.producer] = event.sequence;
+                }, 64)};
+                received[lane] += count;
+                if (count == 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : producers)
+    {
+        thread.join();
+    }
+    for (auto& thread : consumers)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(received[0] + received[1] + received[2], kProducers * kEvents);
+    EXPECT_TRUE(ordered[0] && ordered[1] && ordered[2]);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
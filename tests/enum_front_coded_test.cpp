@@ -0,0 +1,75 @@
+#include "common/enum/front_coded.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+using CodeHolder = trlc::FrontCodedEnumHolder<uint32_t>;
+
+std::vector<CodeHolder::Definition> makeVocabulary(uint32_t count)
+{
+    static const std::vector<std::string> families{"ERROR_NETWORK_TIMEOUT_", "ERROR_NETWORK_REFUSED_", "ERROR_STORAGE_QUOTA_EXCEEDED_", "WARNING_STORAGE_LATENCY_"};
+    std::vector<CodeHolder::Definition> definitions;
+    for (uint32_t index{0}; index < count; ++index)
+    {
+        definitions.emplace_back(index * 7 + 1, families[index % families.size()] + std::to_string(index));
+    }
+    return definitions;
+}
+} // namespace
+
+TEST(FrontCodedEnumHolderTest, FromValueAndString)
+{
+    const auto definitions{makeVocabulary(1000)};
+    const CodeHolder holder{definitions};
+
+    ASSERT_EQ(holder.size(), definitions.size());
+    for (const auto& [value, name] : definitions)
+    {
+        EXPECT_EQ(holder.fromValue(value).name(), name);
+        EXPECT_EQ(holder.fromString(name).value, value);
+    }
+    EXPECT_EQ(holder.fromValue(2).name(), "");
+    EXPECT_EQ(holder.fromString("ERROR_NETWORK_TIMEOUT_1").value, 0u);
+    EXPECT_EQ(holder.fromString("A").value, 0u);
+    EXPECT_EQ(holder.fromString("ZZZ").value, 0u);
+}
+
+TEST(FrontCodedEnumHolderTest, FirstDefinitionWinsAndLongNamesRejected)
+{
+    const CodeHolder holder{{{1, "Ok"}, {2, "Ok"}, {1, "Fine"}, {3, std::string(100, 'x')}}};
+
+    EXPECT_EQ(holder.size(), 2u);
+    EXPECT_EQ(holder.rejected(), 1u);
+    EXPECT_FALSE(holder.valid());
+    EXPECT_FALSE(CodeHolder::create({{1, "Ok"}, {3, std::string(100, 'x')}}));
+    const auto created{CodeHolder::create({{1, "Ok"}, {3, std::string(64, 'x')}})};
+    ASSERT_TRUE(created);
+    EXPECT_TRUE(created->valid());
+    EXPECT_EQ(created->fromValue(3).name(), std::string(64, 'x'));
+    EXPECT_EQ(holder.fromString("Ok").value, 1u);
+    EXPECT_EQ(holder.fromValue(1).name(), "Ok");
+    EXPECT_EQ(holder.fromString("Fine").value, 1u);
+    EXPECT_EQ(holder.fromValue(3).name(), "");
+}
+
+TEST(FrontCodedEnumHolderTest, UsesLessMemoryThanRuntimeHolder)
+{
+    const auto definitions{makeVocabulary(20000)};
+    const CodeHolder holder{definitions};
+
+    size_t plain{0};
+    for (const auto& definition : definitions)
+    {
+        plain += definition.second.size() + sizeof(trlc::Enum<uint32_t>);
+    }
+    EXPECT_LT(holder.memoryUsage() * 2, plain);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "common/enum.hpp"
+#include "common/enum/hierarchy.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+
+namespace Policy = trlc::policy;
+
+namespace
+{
+enum class Event
+{
+    None = 0,
+    Network = 1,
+    Timeout = 2,
+    Connect = 3,
+    Read = 4,
+    Refused = 5,
+    Storage = 6,
+    Full = 7
+};
+
+// Deliberately not in pre-order.
+constexpr std::array<trlc::Enum<Event>, 7> kEvents = {{{Event::Connect, "Connect"},
+                                                      {Event::Network, "Network"},
+                                                      {Event::Storage, "Storage"},
+                                                      {Event::Timeout, "Timeout"},
+                                                      {Event::Full, "Full"},
+                                                      {Event::Read, "Read"},
+                                                      {Event::Refused, "Refused"}}};
+constexpr std::array<Event, 7> kParents = {Event::Timeout, Event::None, Event::None, Event::Network, Event::Storage, Event::Timeout, Event::Network};
+
+using EventHolder = trlc::EnumHolder<Event, kEvents.size(), Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy>;
+constexpr trlc::HierarchicalEnumHolder<EventHolder> kHolder{kEvents, kParents};
+} // namespace
+
+TEST(HierarchicalEnumHolderTest, AncestorTests)
+{
+    static_assert(kHolder.valid());
+    static_assert(kHolder.isWithin(Event::Connect, Event::Network));
+
+    EXPECT_TRUE(kHolder.isWithin(Event::Connect, Event::Timeout));
+    EXPECT_TRUE(kHolder.isWithin(Event::Refused, Event::Network));
+    EXPECT_TRUE(kHolder.isWithin(Event::Network, Event::Network));
+    EXPECT_FALSE(kHolder.isWithin(Event::Network, Event::Connect));
+    EXPECT_FALSE(kHolder.isWithin(Event::Full, Event::Network));
+    EXPECT_FALSE(kHolder.isWithin(Event::Refused, Event::Timeout));
+    EXPECT_FALSE(kHolder.isWithin(Event::None, Event::Network));
+
+    EXPECT_EQ(kHolder.parent(kHolder.indexFromValue(Event::Read)), kHolder.indexFromValue(Event::Timeout));
+    EXPECT_EQ(kHolder.parent(kHolder.indexFromValue(Event::Storage)), kEvents.size());
+}
+
+TEST(HierarchicalEnumHolderTest, SubtreeIsContiguous)
+{
+    const size_t network{kHolder.indexFromValue(Event::Network)};
+    const auto [first, last] = kHolder.subtreeRange(network);
+    EXPECT_EQ(last - first, 5u);
+    EXPECT_EQ(kHolder.slotAt(first), network);
+    for (size_t position{first}; position < last; ++position)
+    {
+        EXPECT_TRUE(kHolder.isWithin(kHolder.slotAt(position), network));
+    }
+
+    static constexpr auto timeouts{kHolder.subtree(kHolder.indexFromValue(Event::Timeout))};
+    static_assert(timeouts.count() == 3);
+    EXPECT_TRUE(timeouts.test(kHolder.indexFromString("Read")));
+    EXPECT_FALSE(timeouts.test(kHolder.indexFromString("Refused")));
+    EXPECT_TRUE(kHolder.subtree(kEvents.size()).none());
+}
+
+TEST(HierarchicalEnumHolderTest, CyclesAreInvalid)
+{
+    static constexpr std::array<trlc::Enum<Event>, 3> entries = {{{Event::Network, "Network"}, {Event::Timeout, "Timeout"}, {Event::Connect, "Connect"}}};
+    using Holder = trlc::EnumHolder<Event, entries.size(), Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy>;
+    static constexpr trlc::HierarchicalEnumHolder<Holder> cyclic{entries, {Event::None, Event::Connect, Event::Timeout}};
+    static_assert(!cyclic.valid());
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
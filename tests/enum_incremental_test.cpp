@@ -0,0 +1,193 @@
+#include "common/enum/incremental.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using CodeHolder = trlc::IncrementalEnumHolder<uint32_t>;
+
+std::vector<CodeHolder::Definition> makeCodes(uint32_t count)
+{
+    std::vector<CodeHolder::Definition> definitions;
+    for (uint32_t index{0}; index < count; ++index)
+    {
+        definitions.emplace_back(index * 2 + 1, "CODE_" + std::to_string(index));
+    }
+    return definitions;
+}
+} // namespace
+
+TEST(IncrementalEnumHolderTest, FromValueAndString)
+{
+    const auto definitions{makeCodes(1000)};
+    const CodeHolder holder{definitions};
+    const auto snapshot{holder.snapshot()};
+
+    ASSERT_EQ(snapshot->size(), definitions.size());
+    for (const auto& [value, name] : definitions)
+    {
+        EXPECT_EQ(snapshot->fromValue(value).name, name);
+        EXPECT_EQ(snapshot->fromString(name).value, value);
+    }
+    EXPECT_EQ(snapshot->fromValue(2).name, "");
+    EXPECT_EQ(snapshot->fromValue(0).name, "");
+    EXPECT_EQ(snapshot->fromString("CODE_1000").value, 0u);
+}
+
+TEST(IncrementalEnumHolderTest, FirstDefinitionWins)
+{
+    const CodeHolder holder{{{1, "Ok"}, {1, "Fine"}, {3, "Ok"}, {5, "Error"}}};
+    const auto snapshot{holder.snapshot()};
+
+    EXPECT_EQ(snapshot->size(), 2u);
+    EXPECT_EQ(snapshot->fromValue(1).name, "Ok");
+    EXPECT_EQ(snapshot->fromString("Fine").value, 0u);
+    EXPECT_EQ(snapshot->fromValue(3).name, "");
+}
+
+TEST(IncrementalEnumHolderTest, AddRemoveRename)
+{
+    CodeHolder holder{makeCodes(500)};
+    const auto before{holder.snapshot()};
+
+    EXPECT_TRUE(holder.add(0, "ZERO"));
+    EXPECT_TRUE(holder.add(10000, "LAST"));
+    EXPECT_FALSE(holder.add(10001, "ZERO"));
+    EXPECT_FALSE(holder.add(1, "ANOTHER"));
+    EXPECT_TRUE(holder.remove("CODE_7"));
+    EXPECT_FALSE(holder.remove("CODE_7"));
+    EXPECT_TRUE(holder.rename("CODE_8", "EIGHT"));
+    EXPECT_FALSE(holder.rename("CODE_9", "EIGHT"));
+
+    const auto after{holder.snapshot()};
+    EXPECT_EQ(after->version(), before->version() + 4);
+    EXPECT_EQ(after->size(), 501u);
+    EXPECT_EQ(after->fromValue(0).name, "ZERO");
+    EXPECT_EQ(after->fromString("LAST").value, 10000u);
+    EXPECT_EQ(after->fromString("CODE_7").value, 0u);
+    EXPECT_EQ(after->fromValue(15).name, "");
+    EXPECT_EQ(after->fromValue(17).name, "EIGHT");
+    EXPECT_EQ(after->fromString("CODE_8").value, 0u);
+
+    // The previous version is untouched.
+    EXPECT_EQ(before->size(), 500u);
+    EXPECT_EQ(before->fromString("CODE_7").value, 15u);
+    EXPECT_EQ(before->fromValue(17).name, "CODE_8");
+    EXPECT_EQ(before->fromString("ZERO").value, 0u);
+
+    const auto entries{after->allValues()};
+    ASSERT_EQ(entries.size(), 501u);
+    for (size_t index{1}; index < entries.size(); ++index)
+    {
+        EXPECT_LT(entries[index - 1].value, entries[index].value);
+    }
+}
+
+TEST(IncrementalEnumHolderTest, BatchPublishesOnce)
+{
+    CodeHolder holder;
+    const size_t changes{holder.edit([](CodeHolder::Editor& editor) {
+        for (uint32_t index{0}; index < 300; ++index)
+        {
+            editor.add(300 - index, "NAME_" + std::to_string(index));
+        }
+        EXPECT_EQ(editor.staged().fromString("NAME_0").value, 300u);
+        editor.remove("NAME_299");
+    })};
+
+    EXPECT_EQ(changes, 301u);
+    const auto snapshot{holder.snapshot()};
+    EXPECT_EQ(snapshot->version(), 1u);
+    EXPECT_EQ(snapshot->size(), 299u);
+    for (uint32_t index{0}; index < 299; ++index)
+    {
+        EXPECT_EQ(snapshot->fromValue(300 - index).name, "NAME_" + std::to_string(index));
+    }
+    EXPECT_EQ(snapshot->fromValue(1).name, "");
+    EXPECT_EQ(holder.edit([](CodeHolder::Editor& editor) { editor.remove("MISSING"); }), 0u);
+    EXPECT_EQ(holder.snapshot()->version(), 1u);
+}
+
+TEST(IncrementalEnumHolderTest, ManyEditsMatchModel)
+{
+    // Enough entries to split chunk pages and grow the buckets over several directory pages.
+    CodeHolder holder{makeCodes(10000)};
+    const auto initial{holder.snapshot()};
+    std::map<uint32_t, std::string> model;
+    for (const auto& [value, name] : makeCodes(10000))
+    {
+        model.emplace(value, name);
+    }
+
+    std::mt19937 random{7};
+    for (size_t round{0}; round < 20000; ++round)
+    {
+        const uint32_t value{static_cast<uint32_t>(random() % 40000)};
+        const std::string name{"CODE_" + std::to_string(value)};
+        if (random() % 3 == 0 && model.count(value) > 0)
+        {
+            ASSERT_TRUE(holder.remove(model[value]));
+            model.erase(value);
+        }
+        else if (model.count(value) == 0 && holder.add(value, name))
+        {
+            model.emplace(value, name);
+        }
+    }
+
+    const auto snapshot{holder.snapshot()};
+    ASSERT_EQ(snapshot->size(), model.size());
+    size_t position{0};
+    const auto entries{snapshot->allValues()};
+    for (const auto& [value, name] : model)
+    {
+        ASSERT_EQ(entries[position].value, value);
+        ASSERT_EQ(entries[position++].name, name);
+        ASSERT_EQ(snapshot->fromString(name).value, value);
+    }
+    // The first version is untouched by the edits.
+    EXPECT_EQ(initial->size(), 10000u);
+    EXPECT_EQ(initial->fromValue(19999).name, "CODE_9999");
+}
+
+TEST(IncrementalEnumHolderTest, ReadersDuringUpdates)
+{
+    CodeHolder holder{makeCodes(1000)};
+    std::atomic<bool> done{false};
+    std::atomic<size_t> inconsistent{0};
+
+    std::thread reader{[&]() {
+        while (!done.load())
+        {
+            const auto snapshot{holder.snapshot()};
+            // Writers toggle CODE_0 and its replacement, so a snapshot always holds exactly one of them.
+            const bool original{snapshot->fromString("CODE_0").value == 1};
+            const bool renamed{snapshot->fromString("RENAMED").value == 1};
+            if (original == renamed || snapshot->size() != 1000 || snapshot->fromValue(1999).name != "CODE_999")
+            {
+                ++inconsistent;
+            }
+        }
+    }};
+
+    for (size_t round{0}; round < 200; ++round)
+    {
+        ASSERT_TRUE(holder.rename("CODE_0", "RENAMED"));
+        ASSERT_TRUE(holder.rename("RENAMED", "CODE_0"));
+    }
+    done.store(true);
+    reader.join();
+    EXPECT_EQ(inconsistent.load(), 0u);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,90 @@
+#include "common/enum/interval.hpp"
+
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+namespace
+{
+enum class HttpClass
+{
+    Unknown = 0,
+    Informational = 1,
+    Success = 2,
+    Redirection = 3,
+    ClientError = 4,
+    ServerError = 5
+};
+
+// Deliberately not sorted by range.
+constexpr std::array<trlc::IntervalEnum<int, HttpClass>, 5> kHttpClasses = {{{400, 499, {HttpClass::ClientError, "ClientError"}},
+                                                                              {100, 199, {HttpClass::Informational, "Informational"}},
+                                                                              {500, 599, {HttpClass::ServerError, "ServerError"}},
+                                                                              {200, 299, {HttpClass::Success, "Success"}},
+                                                                              {300, 399, {HttpClass::Redirection, "Redirection"}}}};
+
+constexpr trlc::IntervalEnumHolder<int, HttpClass, kHttpClasses.size()> kHttpHolder{kHttpClasses};
+
+constexpr std::array<trlc::IntervalEnum<uint16_t, uint32_t>, 3> kPorts = {{{0, 1023, {1, "System"}}, {1024, 49151, {2, "Registered"}}, {49152, 65535, {3, "Dynamic"}}}};
+
+constexpr trlc::IntervalEnumHolder<uint16_t, uint32_t, kPorts.size()> kPortHolder{kPorts};
+} // namespace
+
+TEST(IntervalEnumHolderTest, FromValue)
+{
+    static_assert(kHttpHolder.valid());
+    static_assert(kHttpHolder.fromValue(404).value == HttpClass::ClientError);
+    static_assert(kHttpHolder.fromValue(200).name == "Success");
+
+    EXPECT_EQ(kHttpHolder.fromValue(100).value, HttpClass::Informational);
+    EXPECT_EQ(kHttpHolder.fromValue(199).value, HttpClass::Informational);
+    EXPECT_EQ(kHttpHolder.fromValue(301).value, HttpClass::Redirection);
+    EXPECT_EQ(kHttpHolder.fromValue(599).name, "ServerError");
+    EXPECT_EQ(kHttpHolder.fromValue(99).value, HttpClass::Unknown);
+    EXPECT_EQ(kHttpHolder.fromValue(600).value, HttpClass::Unknown);
+    EXPECT_EQ(kHttpHolder.fromValue(-1).name, "");
+}
+
+TEST(IntervalEnumHolderTest, IndexFromValue)
+{
+    EXPECT_EQ(kHttpHolder.indexFromValue(450), 0u);
+    EXPECT_EQ(kHttpHolder.indexFromValue(250), 3u);
+    EXPECT_EQ(kHttpHolder.indexFromValue(0), kHttpHolder.size());
+
+    for (uint32_t port{0}; port <= 65535; ++port)
+    {
+        const uint32_t expected{port < 1024 ? 1u : port < 49152 ? 2u : 3u};
+        ASSERT_EQ(kPortHolder.fromValue(static_cast<uint16_t>(port)).value, expected);
+    }
+}
+
+TEST(IntervalEnumHolderTest, GapsBetweenRanges)
+{
+    static constexpr std::array<trlc::IntervalEnum<int, int>, 4> kRanges = {{{-50, -10, {1, "Cold"}}, {0, 0, {2, "Zero"}}, {10, 20, {3, "Warm"}}, {40, 41, {4, "Hot"}}}};
+    constexpr trlc::IntervalEnumHolder<int, int, kRanges.size()> holder{kRanges};
+    static_assert(holder.valid());
+
+    for (int key{-60}; key <= 50; ++key)
+    {
+        int expected{0};
+        for (const auto& range : kRanges)
+        {
+            expected = range.low <= key && key <= range.high ? range.entry.value : expected;
+        }
+        ASSERT_EQ(holder.fromValue(key).value, expected) << key;
+    }
+}
+
+TEST(IntervalEnumHolderTest, InvalidRanges)
+{
+    static constexpr std::array<trlc::IntervalEnum<int, int>, 2> kOverlapping = {{{10, 20, {1, "A"}}, {20, 30, {2, "B"}}}};
+    static constexpr std::array<trlc::IntervalEnum<int, int>, 1> kReversed = {{{5, 4, {1, "A"}}}};
+    static_assert(!trlc::IntervalEnumHolder<int, int, 2>{kOverlapping}.valid());
+    static_assert(!trlc::IntervalEnumHolder<int, int, 1>{kReversed}.valid());
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,145 @@
+#include "common/enum/loader.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+
+namespace
+{
+/// Reports lookups that missed while loading with the name `pending`.
+struct PendingPolicy : trlc::policy::UnknownPolicy
+{
+    template<typename T, class Entries, typename CharT>
+    static trlc::Enum<T, CharT> handlePending(std::basic_string_view<CharT>, const Entries&)
+    {
+        return trlc::Enum<T, CharT>{T{}, "pending"};
+    }
+
+    template<typename T, class Entries>
+    static trlc::Enum<T, char> handlePending(T value, const Entries&)
+    {
+        return trlc::Enum<T, char>{value, "pending"};
+    }
+};
+
+std::string writeDictionary(const std::string& fileName, int count, const std::string& tail = {})
+{
+    const std::string path{testing::TempDir() + fileName};
+    std::ofstream file{path, std::ios::trunc};
+    file << "# generated\r\n";
+    for (int index{0}; index < count; ++index)
+    {
+        file << "name" << index << " = " << index << (index % 3 == 0 ? "\r\n" : "\n");
+    }
+    file << tail;
+    return path;
+}
+
+void expectLoaded(const trlc::StreamingEnumLoader<int>& loader, int count)
+{
+    ASSERT_EQ(loader.wait(), trlc::EnumLoadState::Loaded);
+    EXPECT_EQ(loader.snapshot()->size(), static_cast<size_t>(count));
+    EXPECT_EQ(loader.metrics().entries.load(), static_cast<uint64_t>(count));
+    int mismatches{0};
+    for (int index{0}; index < count; ++index)
+    {
+        const std::string name{"name" + std::to_string(index)};
+        mismatches += loader.fromString(name).value != index;
+        mismatches += loader.fromValue(index).name != name;
+    }
+    EXPECT_EQ(mismatches, 0);
+    EXPECT_EQ(loader.fromString("missing").name, "");
+}
+} // namespace
+
+TEST(StreamingEnumLoaderTest, LoadsInChunks)
+{
+    // Small chunks cut most lines in two; the last line has no newline.
+    const std::string path{writeDictionary("loader_chunks.txt", 20000, "name20000 = 20000")};
+    trlc::StreamingEnumLoader<int> loader{path, 1000};
+    expectLoaded(loader, 20001);
+    EXPECT_GT(loader.metrics().batches.load(), 1u);
+
+    std::ifstream file{path, std::ios::binary | std::ios::ate};
+    EXPECT_EQ(loader.metrics().bytesRead.load(), static_cast<uint64_t>(file.tellg()));
+    std::remove(path.c_str());
+}
+
+TEST(StreamingEnumLoaderTest, PreadFallback)
+{
+    const std::string path{writeDictionary("loader_pread.txt", 5000)};
+    trlc::StreamingEnumLoader<int> loader{path, 4096, false};
+    expectLoaded(loader, 5000);
+    EXPECT_FALSE(loader.metrics().ioUring.load());
+    std::remove(path.c_str());
+}
+
+TEST(StreamingEnumLoaderTest, FirstDefinitionWins)
+{
+    const std::string path{writeDictionary("loader_duplicates.txt", 0, "a = 1\nb = 1\na = 2\nc = 3\n")};
+    trlc::StreamingEnumLoader<int> loader{path};
+    ASSERT_EQ(loader.wait(), trlc::EnumLoadState::Loaded);
+    EXPECT_EQ(loader.fromString("a").value, 1);
+    EXPECT_EQ(loader.fromString("b").name, "");
+    EXPECT_EQ(loader.fromValue(2).name, "");
+    EXPECT_EQ(loader.fromValue(3).name, "c");
+    std::remove(path.c_str());
+}
+
+TEST(StreamingEnumLoaderTest, PendingWhileLoading)
+{
+    const std::string path{writeDictionary("loader_pending.txt", 200000)};
+    // Hold the loader after its first version until the lookups below are done.
+    std::promise<void> published;
+    std::promise<void> resume;
+    std::shared_future<void> resumed{resume.get_future().share()};
+    bool first{true};
+    const auto progress = [&](const trlc::EnumLoaderMetrics&) {
+        if (std::exchange(first, false))
+        {
+            published.set_value();
+            resumed.wait();
+        }
+    };
+    trlc::StreamingEnumLoader<int, PendingPolicy> loader{path, 4096, true, progress};
+    published.get_future().wait();
+
+    // A miss is pending for as long as the load runs, and unknown afterwards.
+    EXPECT_EQ(loader.state(), trlc::EnumLoadState::Loading);
+    EXPECT_EQ(loader.fromString("missing").name, "pending");
+    EXPECT_EQ(loader.fromValue(-1).name, "pending");
+    EXPECT_EQ(loader.fromString("name0").value, 0);
+    EXPECT_EQ(loader.fromValue(199999).name, "pending");
+    resume.set_value();
+
+    ASSERT_EQ(loader.wait(), trlc::EnumLoadState::Loaded);
+    EXPECT_EQ(loader.fromString("missing").name, "");
+    EXPECT_EQ(loader.fromValue(-1).name, "");
+    EXPECT_EQ(loader.fromValue(199999).name, "name199999");
+    EXPECT_GT(loader.metrics().batches.load(), 1u);
+    std::remove(path.c_str());
+}
+
+TEST(StreamingEnumLoaderTest, Failures)
+{
+    const std::string path{writeDictionary("loader_malformed.txt", 10, "broken line\nlater = 100\n")};
+    trlc::StreamingEnumLoader<int> loader{path};
+    EXPECT_EQ(loader.wait(), trlc::EnumLoadState::Failed);
+    // Entries before the malformed line stay published.
+    EXPECT_EQ(loader.fromString("name9").value, 9);
+    EXPECT_EQ(loader.fromString("later").name, "");
+    std::remove(path.c_str());
+
+    trlc::StreamingEnumLoader<int> missing{path + ".missing"};
+    EXPECT_EQ(missing.wait(), trlc::EnumLoadState::Failed);
+    EXPECT_EQ(missing.snapshot()->size(), 0u);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
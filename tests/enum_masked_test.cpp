@@ -0,0 +1,162 @@
+#include "common/enum/masked.hpp"
+
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+
+namespace
+{
+enum class Op
+{
+    Unknown = 0,
+    Add,
+    Sub,
+    Sll,
+    Xor,
+    Or,
+    And,
+    Addi,
+    Xori,
+    Ori,
+    Andi,
+    Lw,
+    Sw,
+    Beq,
+    Bne,
+    Jal,
+    Lui,
+    Ecall
+};
+
+// A subset of the RV32I encodings; ECALL is listed before the I-type rows it refines.
+constexpr std::array<trlc::MaskedEnum<uint32_t, Op>, 17> kOps = {{{0xFFFFFFFF, 0x00000073, {Op::Ecall, "ecall"}},
+                                                                 {0xFE00707F, 0x00000033, {Op::Add, "add"}},
+                                                                 {0xFE00707F, 0x40000033, {Op::Sub, "sub"}},
+                                                                 {0xFE00707F, 0x00001033, {Op::Sll, "sll"}},
+                                                                 {0xFE00707F, 0x00004033, {Op::Xor, "xor"}},
+                                                                 {0xFE00707F, 0x00006033, {Op::Or, "or"}},
+                                                                 {0xFE00707F, 0x00007033, {Op::And, "and"}},
+                                                                 {0x0000707F, 0x00000013, {Op::Addi, "addi"}},
+                                                                 {0x0000707F, 0x00004013, {Op::Xori, "xori"}},
+                                                                 {0x0000707F, 0x00006013, {Op::Ori, "ori"}},
+                                                                 {0x0000707F, 0x00007013, {Op::Andi, "andi"}},
+                                                                 {0x0000707F, 0x00002003, {Op::Lw, "lw"}},
+                                                                 {0x0000707F, 0x00002023, {Op::Sw, "sw"}},
+                                                                 {0x0000707F, 0x00000063, {Op::Beq, "beq"}},
+                                                                 {0x0000707F, 0x00001063, {Op::Bne, "bne"}},
+                                                                 {0x0000007F, 0x0000006F, {Op::Jal, "jal"}},
+                                                                 {0x0000007F, 0x00000037, {Op::Lui, "lui"}}}};
+
+constexpr trlc::MaskedEnumHolder<uint32_t, Op, kOps.size()> kDecoder{kOps};
+
+template<typename K, size_t N>
+size_t linearMatch(K key, const std::array<trlc::MaskedEnum<K, uint32_t>, N>& entries)
+{
+    for (size_t index{0}; index < N; ++index)
+    {
+        if ((key & entries[index].mask) == entries[index].pattern)
+        {
+            return index;
+        }
+    }
+    return N;
+}
+} // namespace
+
+TEST(MaskedEnumHolderTest, DecodesInstructions)
+{
+    static_assert(kDecoder.valid());
+    static_assert(kDecoder.fromValue(0x00B50533).value == Op::Add);
+    static_assert(kDecoder.fromValue(0x40B50533).value == Op::Sub);
+
+    EXPECT_EQ(kDecoder.fromValue(0x00000073).value, Op::Ecall);
+    EXPECT_EQ(kDecoder.fromValue(0x00150513).name, "addi");
+    EXPECT_EQ(kDecoder.fromValue(0x0005A503).value, Op::Lw);
+    EXPECT_EQ(kDecoder.fromValue(0x00A5A023).value, Op::Sw);
+    EXPECT_EQ(kDecoder.fromValue(0xFE0718E3).value, Op::Bne);
+    EXPECT_EQ(kDecoder.fromValue(0x0080006F).value, Op::Jal);
+    EXPECT_EQ(kDecoder.fromValue(0x000122B7).value, Op::Lui);
+    EXPECT_EQ(kDecoder.fromValue(0x0000007B).value, Op::Unknown);
+    EXPECT_EQ(kDecoder.indexFromValue(0x0000007B), kDecoder.size());
+}
+
+TEST(MaskedEnumHolderTest, MatchesLinearScan)
+{
+    // Overlapping masks on 16-bit keys, and a 2-bit table whose cells overflow into branches.
+    static constexpr std::array<trlc::MaskedEnum<uint16_t, uint32_t>, 12> kPackets = {{{0xFF00, 0x1200, {1, "A"}},
+                                                                                      {0xF000, 0x1000, {2, "B"}},
+                                                                                      {0x00FF, 0x0034, {3, "C"}},
+                                                                                      {0x0F0F, 0x0505, {4, "D"}},
+                                                                                      {0x8001, 0x8001, {5, "E"}},
+                                                                                      {0x8001, 0x8000, {6, "F"}},
+                                                                                      {0x0001, 0x0001, {7, "G"}},
+                                                                                      {0x00F0, 0x00A0, {8, "H"}},
+                                                                                      {0xF0F0, 0x3030, {9, "I"}},
+                                                                                      {0x0C00, 0x0400, {10, "J"}},
+                                                                                      {0x0300, 0x0200, {11, "K"}},
+                                                                                      {0x0000, 0x0000, {12, "Any"}}}};
+    constexpr trlc::MaskedEnumHolder<uint16_t, uint32_t, kPackets.size()> wide{kPackets};
+    constexpr trlc::MaskedEnumHolder<uint16_t, uint32_t, kPackets.size(), trlc::policy::UnknownPolicy, char, 2> narrow{kPackets};
+    static_assert(wide.valid());
+    static_assert(wide.scanNodes() == 0 && narrow.scanNodes() == 0);
+
+    for (uint32_t key{0}; key <= 0xFFFF; ++key)
+    {
+        const size_t expected{linearMatch(static_cast<uint16_t>(key), kPackets)};
+        ASSERT_EQ(wide.indexFromValue(static_cast<uint16_t>(key)), expected) << key;
+        ASSERT_EQ(narrow.indexFromValue(static_cast<uint16_t>(key)), expected) << key;
+    }
+}
+
+TEST(MaskedEnumHolderTest, RandomKeys)
+{
+    std::mt19937 random{7};
+    for (int round{0}; round < 100000; ++round)
+    {
+        const uint32_t key{static_cast<uint32_t>(random())};
+        size_t expected{kOps.size()};
+        for (size_t index{0}; index < kOps.size() && expected == kOps.size(); ++index)
+        {
+            expected = (key & kOps[index].mask) == kOps[index].pattern ? index : expected;
+        }
+        ASSERT_EQ(kDecoder.indexFromValue(key), expected) << key;
+    }
+}
+
+TEST(MaskedEnumHolderTest, GeneralEntriesStayInTheTable)
+{
+    // Nested prefixes of growing generality, all of them in every cell of a 1-bit table, then a catch-all.
+    static constexpr std::array<trlc::MaskedEnum<uint16_t, uint32_t>, 10> kRoutes = {{{0xFFFF, 0x1234, {1, "Host"}},
+                                                                                     {0xFFF0, 0x1230, {2, "Subnet"}},
+                                                                                     {0xFF00, 0x1200, {3, "Site"}},
+                                                                                     {0xF000, 0x1000, {4, "Region"}},
+                                                                                     {0x00FF, 0x0034, {5, "Port"}},
+                                                                                     {0x000F, 0x0004, {6, "Lane"}},
+                                                                                     {0x0F0F, 0x0202, {7, "Pair"}},
+                                                                                     {0x8000, 0x8000, {8, "Upper"}},
+                                                                                     {0x0001, 0x0001, {9, "Odd"}},
+                                                                                     {0x0000, 0x0000, {10, "Any"}}}};
+    constexpr trlc::MaskedEnumHolder<uint16_t, uint32_t, kRoutes.size(), trlc::policy::UnknownPolicy, char, 1> holder{kRoutes};
+    static_assert(holder.scanNodes() == 0);
+    static_assert(holder.fromValue(0x1234).value == 1);
+    static_assert(holder.fromValue(0x1237).value == 2);
+    static_assert(holder.fromValue(0x0002).value == 10);
+
+    for (uint32_t key{0}; key <= 0xFFFF; ++key)
+    {
+        ASSERT_EQ(holder.indexFromValue(static_cast<uint16_t>(key)), linearMatch(static_cast<uint16_t>(key), kRoutes)) << key;
+    }
+}
+
+TEST(MaskedEnumHolderTest, InvalidPattern)
+{
+    static constexpr std::array<trlc::MaskedEnum<uint8_t, uint32_t>, 1> kInvalid = {{{0x0F, 0x1F, {1, "A"}}}};
+    static_assert(!trlc::MaskedEnumHolder<uint8_t, uint32_t, 1>{kInvalid}.valid());
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
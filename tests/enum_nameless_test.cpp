@@ -0,0 +1,62 @@
+#define TRLC_ENUM_NAMELESS
+#include "common/enum.hpp"
+
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <type_traits>
+
+namespace
+{
+enum class Signal : uint8_t
+{
+    None = 0,
+    Start = 1,
+    Stop = 2,
+    Pause = 3
+};
+
+// The table keeps its usual initializers; the names are discarded at compile time.
+constexpr std::array<trlc::Enum<Signal>, 4> signalEntries = {{{Signal::None, "None"},
+                                                             {Signal::Start, "Start"},
+                                                             {Signal::Stop, "Stop"},
+                                                             {Signal::Pause, "Pause"}}};
+
+namespace Policy = trlc::policy;
+using SignalHolder = trlc::EnumHolder<Signal, signalEntries.size(), Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy>;
+
+template<typename E, typename = void>
+struct HasName : std::false_type
+{
+};
+
+template<typename E>
+struct HasName<E, std::void_t<decltype(std::declval<E>().name)>> : std::true_type
+{
+};
+} // namespace
+
+TEST(NamelessEnumTest, EntriesShrinkToValue)
+{
+    static_assert(sizeof(trlc::Enum<Signal>) == sizeof(Signal), "nameless entries only hold the value");
+    static_assert(sizeof(signalEntries) == signalEntries.size(), "nameless tables are dense");
+    static_assert(!HasName<trlc::Enum<Signal>>::value, "nameless entries have no name member");
+    EXPECT_EQ(sizeof(trlc::Enum<uint64_t>), sizeof(uint64_t));
+}
+
+TEST(NamelessEnumTest, FromValueKeepsWorking)
+{
+    constexpr SignalHolder holder{signalEntries};
+    static_assert(holder.fromValue(Signal::Stop).value == Signal::Stop, "fromValue works at compile time");
+
+    EXPECT_EQ(holder.fromValue(Signal::Start).value, Signal::Start);
+    EXPECT_EQ(holder.fromValue(Signal::Pause).value, Signal::Pause);
+    EXPECT_EQ(holder.fromValue(static_cast<Signal>(9)).value, Signal::None);
+    EXPECT_TRUE(trlc::Enum<Signal>(Signal::Stop, "Stop") == trlc::Enum<Signal>{Signal::Stop});
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
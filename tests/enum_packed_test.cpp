@@ -0,0 +1,98 @@
+#include "common/enum.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string_view>
+
+using namespace std::literals;
+
+namespace
+{
+enum class Opcode
+{
+    Unknown = 0,
+    Nop,
+    Load,
+    Store,
+    Add,
+    Sub,
+    Jump,
+    JumpIfZero,
+    CompareAndSwapStrong,
+    LoadDuplicate
+};
+
+constexpr std::array<trlc::Enum<Opcode>, 10> opcodeEntries = {{{Opcode::Unknown, ""},
+                                                              {Opcode::Nop, "Nop"},
+                                                              {Opcode::Load, "Load"},
+                                                              {Opcode::Store, "Store"},
+                                                              {Opcode::Add, "Add"},
+                                                              {Opcode::Sub, "Sub"},
+                                                              {Opcode::Jump, "Jump"},
+                                                              {Opcode::JumpIfZero, "JumpIfZero16byte"},
+                                                              {Opcode::CompareAndSwapStrong, "CompareAndSwapStrong"},
+                                                              {Opcode::LoadDuplicate, "Load"}}};
+
+namespace Policy = trlc::policy;
+} // namespace
+
+TEST(SimdStringSearchTest, FindsNamesOfEveryLength)
+{
+    constexpr trlc::EnumHolder<Opcode, opcodeEntries.size(), Policy::LinearSearchPolicy, Policy::SimdStringSearchPolicy, Policy::UnknownPolicy> holder{opcodeEntries};
+    static_assert(holder.fromString("Store").value == Opcode::Store, "packed lanes are usable at compile time");
+
+    EXPECT_EQ(holder.fromString("Nop").value, Opcode::Nop);
+    EXPECT_EQ(holder.fromString("Add").value, Opcode::Add);
+    EXPECT_EQ(holder.fromString("Sub").value, Opcode::Sub);
+    EXPECT_EQ(holder.fromString("Jump").value, Opcode::Jump);
+    EXPECT_EQ(holder.fromString("Load").value, Opcode::Load); // first definition wins
+    EXPECT_EQ(holder.fromString("JumpIfZero16byte").value, Opcode::JumpIfZero);
+    EXPECT_EQ(holder.fromString("CompareAndSwapStrong").value, Opcode::CompareAndSwapStrong);
+    EXPECT_EQ(holder.fromString("").value, Opcode::Unknown);
+    EXPECT_EQ(holder.fromString("Mul").value, Opcode::Unknown);
+    EXPECT_EQ(holder.fromString("Nop\0"sv.substr(0, 4)).value, Opcode::Unknown);
+    EXPECT_EQ(holder.fromString("JumpIfZero16bytf").value, Opcode::Unknown);
+    EXPECT_EQ(holder.fromString("CompareAndSwapWeak").value, Opcode::Unknown);
+}
+
+TEST(SimdStringSearchTest, WideNames)
+{
+    static constexpr std::array<trlc::Enum<Opcode, char16_t>, 3> entries = {{{Opcode::Load, u"Load"}, {Opcode::Store, u"Store"}, {Opcode::JumpIfZero, u"JumpIfZero"}}};
+    constexpr trlc::EnumHolder<Opcode, entries.size(), Policy::LinearSearchPolicy, Policy::SimdStringSearchPolicy, Policy::UnknownPolicy, char16_t> holder{entries};
+
+    EXPECT_EQ(holder.fromString(u"Store").value, Opcode::Store);
+    EXPECT_EQ(holder.fromString(u"JumpIfZero").value, Opcode::JumpIfZero);
+    EXPECT_EQ(holder.fromString(u"Loaf").value, Opcode::Unknown);
+}
+
+TEST(PackedKeyStringSearchTest, FindsShortAndLongNames)
+{
+    constexpr trlc::EnumHolder<Opcode, opcodeEntries.size(), Policy::LinearSearchPolicy, Policy::PackedKeyStringSearchPolicy, Policy::UnknownPolicy> holder{opcodeEntries};
+    static_assert(holder.fromString("Sub").value == Opcode::Sub, "packed keys are usable at compile time");
+
+    for (const auto& entry : opcodeEntries)
+    {
+        EXPECT_EQ(holder.fromString(entry.name).value, entry.value == Opcode::LoadDuplicate ? Opcode::Load : entry.value);
+    }
+    EXPECT_EQ(holder.fromString("Nop\0"sv).value, Opcode::Unknown);
+    EXPECT_EQ(holder.fromString("Mul").value, Opcode::Unknown);
+    EXPECT_EQ(holder.fromString("JumpIfZero16bytf").value, Opcode::Unknown);
+    EXPECT_EQ(holder.fromString("CompareAndSwapWeak").value, Opcode::Unknown);
+}
+
+TEST(PackedKeyStringSearchTest, WideNames)
+{
+    static constexpr std::array<trlc::Enum<Opcode, wchar_t>, 3> entries = {{{Opcode::Store, L"Store"}, {Opcode::Load, L"Load"}, {Opcode::JumpIfZero, L"JumpIfZero"}}};
+    constexpr trlc::EnumHolder<Opcode, entries.size(), Policy::LinearSearchPolicy, Policy::PackedKeyStringSearchPolicy, Policy::UnknownPolicy, wchar_t> holder{entries};
+
+    EXPECT_EQ(holder.fromString(L"Store").value, Opcode::Store);
+    EXPECT_EQ(holder.fromString(L"Load").value, Opcode::Load);
+    EXPECT_EQ(holder.fromString(L"JumpIfZero").value, Opcode::JumpIfZero);
+    EXPECT_EQ(holder.fromString(L"Jump").value, Opcode::Unknown);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
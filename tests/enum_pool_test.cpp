@@ -0,0 +1,81 @@
+#include "common/enum.hpp"
+#include "common/enum/pool.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string_view>
+
+namespace Policy = trlc::policy;
+
+namespace
+{
+enum class Color
+{
+    None = 0,
+    Red = 1,
+    Green = 2,
+    Unknown = 3
+};
+
+enum class Mode
+{
+    None = 0,
+    Fast = 1,
+    Safe = 2,
+    Unknown = 3,
+    Default = 4
+};
+
+constexpr std::array<trlc::Enum<Color>, 4> kColors = {{{Color::None, "None"}, {Color::Red, "Red"}, {Color::Green, "Green"}, {Color::Unknown, "Unknown"}}};
+constexpr std::array<trlc::Enum<Mode>, 5> kModes = {{{Mode::None, "None"}, {Mode::Fast, "Fast"}, {Mode::Safe, "Safe"}, {Mode::Unknown, "Unknown"}, {Mode::Default, "Default"}}};
+constexpr std::array<trlc::DefaultEnum, 3> kCodes = {{{0, "None"}, {1, "Red"}, {2, "Error"}}};
+
+using Pool = trlc::NamePool<kColors, kModes, kCodes>;
+
+using ColorHolder = trlc::EnumHolder<Color, kColors.size(), Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy>;
+using ModeHolder = trlc::EnumHolder<Mode, kModes.size(), Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy>;
+
+constexpr ColorHolder kColorHolder{Pool::kEntries<0>};
+constexpr ModeHolder kModeHolder{Pool::kEntries<1>};
+constexpr trlc::DefaultEnumHolder<kCodes.size()> kCodeHolder{Pool::kEntries<2>};
+} // namespace
+
+TEST(NamePoolTest, StoresEachNameOnce)
+{
+    static_assert(Pool::kNames == 12);
+    static_assert(Pool::kDistinct == 8);
+    static_assert(Pool::kBlob.size() == std::string_view{"DefaultErrorFastGreenNoneRedSafeUnknown"}.size());
+    EXPECT_EQ((std::string_view{Pool::kBlob.data(), Pool::kBlob.size()}), "DefaultErrorFastGreenNoneRedSafeUnknown");
+}
+
+TEST(NamePoolTest, NamesShareStorageAcrossHolders)
+{
+    static_assert(kColorHolder.fromValue(Color::Green).name == "Green");
+    static_assert(kModeHolder.fromString("Default").value == Mode::Default);
+
+    EXPECT_EQ(kColorHolder.fromValue(Color::None).name.data(), kModeHolder.fromValue(Mode::None).name.data());
+    EXPECT_EQ(kColorHolder.fromValue(Color::Unknown).name.data(), kModeHolder.fromValue(Mode::Unknown).name.data());
+    EXPECT_EQ(kColorHolder.fromValue(Color::Red).name.data(), kCodeHolder.fromValue(1).name.data());
+    EXPECT_GE(kColorHolder.fromValue(Color::Red).name.data(), Pool::kBlob.data());
+    EXPECT_LT(kColorHolder.fromValue(Color::Red).name.data(), Pool::kBlob.data() + Pool::kBlob.size());
+
+    // A name taken from one holder finds the entry of another by pointer.
+    EXPECT_EQ(kModeHolder.fromString(kColorHolder.fromValue(Color::Unknown).name).value, Mode::Unknown);
+    EXPECT_EQ(kCodeHolder.fromString(kColorHolder.fromValue(Color::Red).name).value, 1u);
+    EXPECT_EQ(kColorHolder.fromString(std::string{"Green"}).value, Color::Green);
+    EXPECT_EQ(kColorHolder.fromString("Blue").value, Color::None);
+}
+
+TEST(NamePoolTest, Intern)
+{
+    static_assert(Pool::intern("Safe") == "Safe");
+    EXPECT_EQ(Pool::intern("Safe").data(), kModeHolder.fromValue(Mode::Safe).name.data());
+    constexpr std::string_view kMissing{"Missing"};
+    EXPECT_EQ(Pool::intern(kMissing).data(), kMissing.data());
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,137 @@
+#include "common/enum.hpp"
+#include "common/enum/product.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string_view>
+#include <utility>
+
+namespace Policy = trlc::policy;
+
+namespace
+{
+enum class State
+{
+    Idle = 1,
+    Connecting = 2,
+    Connected = 3,
+    Closed = 4
+};
+
+enum class Event
+{
+    Open = 10,
+    Ack = 11,
+    Data = 12,
+    Close = 13,
+    Timeout = 14
+};
+
+constexpr std::array<trlc::Enum<State>, 4> kStates = {{{State::Idle, "Idle"}, {State::Connecting, "Connecting"}, {State::Connected, "Connected"}, {State::Closed, "Closed"}}};
+constexpr std::array<trlc::Enum<Event>, 5> kEvents = {
+    {{Event::Open, "Open"}, {Event::Ack, "Ack"}, {Event::Data, "Data"}, {Event::Close, "Close"}, {Event::Timeout, "Timeout"}}};
+
+using StateHolder = trlc::EnumHolder<State, kStates.size(), Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy>;
+using EventHolder = trlc::EnumHolder<Event, kEvents.size(), Policy::SortedSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy>;
+
+constexpr StateHolder kStateHolder{kStates};
+constexpr EventHolder kEventHolder{kEvents};
+
+using Transitions = trlc::ProductTable<State, StateHolder, EventHolder>;
+using SparseTransitions = trlc::SparseProductTable<State, 6, StateHolder, EventHolder>;
+
+constexpr std::array<Transitions::Entry, 6> kTransitions = {{{{State::Idle, Event::Open}, State::Connecting},
+                                                             {{State::Connecting, Event::Ack}, State::Connected},
+                                                             {{State::Connecting, Event::Timeout}, State::Idle},
+                                                             {{State::Connected, Event::Data}, State::Connected},
+                                                             {{State::Connected, Event::Close}, State::Closed},
+                                                             {{State::Connected, Event::Close}, State::Idle}}};
+
+constexpr Transitions kTable{kStateHolder, kEventHolder, kTransitions};
+constexpr SparseTransitions kSparseTable{kStateHolder, kEventHolder, kTransitions};
+
+// Tuple assignment is not constexpr before C++20, so the entries are built in one initializer.
+template<class Entry, uint64_t... I>
+constexpr std::array<Entry, sizeof...(I)> makeEntries(std::integer_sequence<uint64_t, I...>)
+{
+    return {Entry{{I % 64 * 7, I / 64 * 7, I * 11 % 64 * 7}, static_cast<uint32_t>(I + 1)}...};
+}
+} // namespace
+
+TEST(ProductIndexTest, MixedRadix)
+{
+    using Index = trlc::ProductIndex<StateHolder, EventHolder>;
+    constexpr Index index{kStateHolder, kEventHolder};
+    static_assert(Index::kSize == 20);
+    static_assert(index.fromValues(State::Idle, Event::Open) == 0);
+    static_assert(index.fromValues(State::Connecting, Event::Data) == 1 * 5 + 2);
+    static_assert(index.fromValues(State::Closed, Event::Timeout) == 19);
+    static_assert(index.fromValues(static_cast<State>(9), Event::Open) == Index::kSize);
+
+    for (size_t slot{0}; slot < Index::kSize; ++slot)
+    {
+        EXPECT_EQ(Index::fromIndices(Index::toIndices(slot)), slot);
+    }
+    EXPECT_EQ(Index::fromIndices({4, 0}), Index::kSize);
+    EXPECT_EQ(Index::fromIndices({0, 5}), Index::kSize);
+}
+
+TEST(ProductTableTest, FlatTable)
+{
+    static_assert(kTable.get(State::Idle, Event::Open) == State::Connecting);
+    static_assert(kTable.contains(State::Connected, Event::Close));
+
+    EXPECT_EQ(kTable.get(State::Connecting, Event::Ack), State::Connected);
+    EXPECT_EQ(kTable.get(State::Connected, Event::Close), State::Closed);
+    EXPECT_FALSE(kTable.contains(State::Closed, Event::Open));
+    EXPECT_EQ(kTable.get(State::Closed, Event::Open), State{});
+    EXPECT_FALSE(kTable.contains(State::Idle, static_cast<Event>(99)));
+}
+
+TEST(ProductTableTest, SparseTableMatchesFlatTable)
+{
+    static_assert(kSparseTable.valid());
+    static_assert(kSparseTable.get(State::Connecting, Event::Timeout) == State::Idle);
+
+    for (const auto& state : kStates)
+    {
+        for (const auto& event : kEvents)
+        {
+            EXPECT_EQ(kSparseTable.contains(state.value, event.value), kTable.contains(state.value, event.value));
+            EXPECT_EQ(kSparseTable.get(state.value, event.value), kTable.get(state.value, event.value));
+        }
+    }
+    EXPECT_FALSE(kSparseTable.contains(static_cast<State>(0), Event::Open));
+}
+
+TEST(ProductTableTest, SparseTableOverLargeProduct)
+{
+    // 64 x 64 x 64 combinations, 200 of them stored.
+    static constexpr std::array<trlc::DefaultEnum, 64> kAxis{[]() {
+        std::array<trlc::DefaultEnum, 64> entries{};
+        for (size_t index{0}; index < entries.size(); ++index)
+        {
+            entries[index] = trlc::DefaultEnum{index * 7, "Axis"};
+        }
+        return entries;
+    }()};
+    static constexpr trlc::DefaultEnumHolder<64> kAxisHolder{kAxis};
+    using Table = trlc::SparseProductTable<uint32_t, 200, trlc::DefaultEnumHolder<64>, trlc::DefaultEnumHolder<64>, trlc::DefaultEnumHolder<64>>;
+
+    static constexpr std::array<Table::Entry, 200> kEntries{makeEntries<Table::Entry>(std::make_integer_sequence<uint64_t, 200>{})};
+    static constexpr Table kLarge{kAxisHolder, kAxisHolder, kAxisHolder, kEntries};
+    static_assert(kLarge.valid());
+
+    for (uint64_t index{0}; index < kEntries.size(); ++index)
+    {
+        EXPECT_EQ(kLarge.get(index % 64 * 7, index / 64 * 7, index * 11 % 64 * 7), index + 1);
+    }
+    EXPECT_FALSE(kLarge.contains(7, 0, 0));
+    EXPECT_FALSE(kLarge.contains(1, 0, 0));
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,208 @@
+#include "common/enum/runtime.hpp"
+#include "common/enum/watcher.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+enum class Status
+{
+    Unknown = 0,
+    Ok = 1,
+    Warning = 2,
+    Error = 3
+};
+
+using StatusHolder = trlc::RuntimeEnumHolder<Status>;
+
+void writeFile(const std::string& path, const std::string& content)
+{
+    // Write next to the target and rename so the watcher never sees a half-written file.
+    const std::string temporary{path + ".tmp"};
+    {
+        std::ofstream file{temporary, std::ios::trunc};
+        file << content;
+    }
+    std::rename(temporary.c_str(), path.c_str());
+}
+
+template<typename Predicate>
+bool waitFor(Predicate predicate)
+{
+    const auto deadline{std::chrono::steady_clock::now() + std::chrono::seconds(5)};
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+} // namespace
+
+TEST(RuntimeEnumHolderTest, FromValueAndString)
+{
+    StatusHolder holder{{{Status::Warning, "Warning"}, {Status::Ok, "Ok"}, {Status::Error, "Error"}}};
+
+    EXPECT_EQ(holder.size(), 3u);
+    EXPECT_EQ(holder.fromValue(Status::Ok).name, "Ok");
+    EXPECT_EQ(holder.fromValue(Status::Error).name, "Error");
+    EXPECT_EQ(holder.fromValue(Status::Unknown).name, "");
+    EXPECT_EQ(holder.fromString("Warning").value, Status::Warning);
+    EXPECT_EQ(holder.fromString("Critical").value, Status::Unknown);
+}
+
+TEST(RuntimeEnumHolderTest, FirstDefinitionWins)
+{
+    StatusHolder holder{{{Status::Ok, "Ok"}, {Status::Ok, "Fine"}, {Status::Error, "Ok"}}};
+
+    EXPECT_EQ(holder.fromValue(Status::Ok).name, "Ok");
+    EXPECT_EQ(holder.fromString("Ok").value, Status::Ok);
+    EXPECT_EQ(holder.fromString("Fine").value, Status::Ok);
+}
+
+TEST(RuntimeEnumHolderTest, Utf16Names)
+{
+    trlc::RuntimeEnumHolder<Status, trlc::policy::UnknownPolicy, char16_t> holder{{{Status::Ok, u"Ok"}, {Status::Error, u"Error"}}};
+
+    EXPECT_EQ(holder.fromString(u"Error").value, Status::Error);
+    EXPECT_TRUE(holder.fromValue(Status::Ok).name == u"Ok");
+    EXPECT_EQ(holder.fromString(u"Warning").value, Status::Unknown);
+}
+
+TEST(RuntimeEnumHolderTest, SipHashReferenceVector)
+{
+    // Test vector of the SipHash paper: key 00..0f, message 00..0e.
+    const trlc::detail::HashSeed key{0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL};
+    unsigned char message[15];
+    for (unsigned char index{0}; index < sizeof(message); ++index)
+    {
+        message[index] = index;
+    }
+    EXPECT_EQ((trlc::detail::sipHash<2, 4>(key, message, sizeof(message))), 0xa129ca6149be45e5ULL);
+}
+
+TEST(RuntimeEnumHolderTest, KeyedNameHash)
+{
+    const auto first{trlc::detail::nextHashSeed()};
+    const auto second{trlc::detail::nextHashSeed()};
+    EXPECT_FALSE(first.k0 == second.k0 && first.k1 == second.k1);
+    EXPECT_EQ(trlc::detail::hashName(std::string_view{"Warning"}, first), trlc::detail::hashName(std::string_view{"Warning"}, first));
+    EXPECT_NE(trlc::detail::hashName(std::string_view{"Warning"}, first), trlc::detail::hashName(std::string_view{"Warning"}, second));
+}
+
+TEST(RuntimeEnumHolderTest, ManyNames)
+{
+    std::vector<trlc::RuntimeEnumHolder<uint32_t>::Definition> definitions;
+    for (uint32_t index{0}; index < 100000; ++index)
+    {
+        definitions.emplace_back(index, "NAME_" + std::to_string(index));
+    }
+    const trlc::RuntimeEnumHolder<uint32_t> holder{definitions};
+
+    for (const auto& [value, name] : definitions)
+    {
+        ASSERT_EQ(holder.fromString(name).value, value);
+    }
+    EXPECT_EQ(holder.fromString("NAME_100000").name, "");
+    EXPECT_EQ(holder.fromString("").name, "");
+}
+
+TEST(RuntimeEnumHolderTest, ConcurrentFirstLookups)
+{
+    std::vector<std::pair<Status, std::string>> definitions;
+    for (int index{0}; index < 1000; ++index)
+    {
+        definitions.emplace_back(static_cast<Status>(index), "name" + std::to_string(index));
+    }
+    const StatusHolder holder{definitions};
+
+    // Every thread races to build both indices; each must see them complete.
+    std::vector<std::thread> threads;
+    std::vector<int> mismatches(4, 0);
+    for (size_t thread{0}; thread < mismatches.size(); ++thread)
+    {
+        threads.emplace_back([&holder, &mismatches, thread]() {
+            for (int index{0}; index < 1000; ++index)
+            {
+                const std::string name{"name" + std::to_string(index)};
+                mismatches[thread] += holder.fromString(name).value != static_cast<Status>(index);
+                mismatches[thread] += holder.fromValue(static_cast<Status>(index)).name != name;
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (const int count : mismatches)
+    {
+        EXPECT_EQ(count, 0);
+    }
+}
+
+TEST(RuntimeEnumHolderTest, WarmUp)
+{
+    const StatusHolder holder{{{Status::Ok, "Ok"}, {Status::Error, "Error"}}};
+    holder.warmUp();
+    holder.warmUp();
+    EXPECT_EQ(holder.fromString("Error").value, Status::Error);
+    EXPECT_EQ(holder.fromValue(Status::Ok).name, "Ok");
+}
+
+TEST(RuntimeEnumHolderTest, FromFile)
+{
+    const std::string path{testing::TempDir() + "runtime_enum_from_file.txt"};
+    writeFile(path, "# statuses\nOk = 1\n\n  Warning=2  \nError = 3\n");
+
+    const auto holder{StatusHolder::fromFile(path)};
+    ASSERT_TRUE(holder);
+    EXPECT_EQ(holder->size(), 3u);
+    EXPECT_EQ(holder->fromString("Warning").value, Status::Warning);
+    EXPECT_EQ(holder->fromValue(Status::Error).name, "Error");
+
+    writeFile(path, "Ok = one\n");
+    EXPECT_FALSE(StatusHolder::fromFile(path));
+    EXPECT_FALSE(StatusHolder::fromFile(path + ".missing"));
+    std::remove(path.c_str());
+}
+
+TEST(EnumDictionaryWatcherTest, RebuildsOnChange)
+{
+    const std::string path{testing::TempDir() + "runtime_enum_watched.txt"};
+    writeFile(path, "Ok = 1\n");
+
+    trlc::EnumDictionaryWatcher<Status> watcher{path};
+    ASSERT_TRUE(watcher.watching());
+    const auto first{watcher.current()};
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first->fromString("Error").value, Status::Unknown);
+
+    writeFile(path, "Ok = 1\nError = 3\n");
+    ASSERT_TRUE(waitFor([&watcher]() { return watcher.metrics().reloads.load() >= 2; }));
+    EXPECT_EQ(watcher.current()->fromString("Error").value, Status::Error);
+    // Readers holding the previous version keep a consistent view.
+    EXPECT_EQ(first->fromString("Error").value, Status::Unknown);
+    EXPECT_EQ(first->fromValue(Status::Ok).name, "Ok");
+
+    writeFile(path, "broken line\n");
+    ASSERT_TRUE(waitFor([&watcher]() { return watcher.metrics().failures.load() >= 1; }));
+    EXPECT_EQ(watcher.current()->fromString("Error").value, Status::Error);
+    EXPECT_GT(watcher.metrics().lastRebuildNanos.load(), 0u);
+    EXPECT_GE(watcher.metrics().maxSwapNanos.load(), watcher.metrics().lastSwapNanos.load());
+    std::remove(path.c_str());
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
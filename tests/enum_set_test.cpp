@@ -0,0 +1,105 @@
+#include "common/enum.hpp"
+#include "common/enum/set.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace Policy = trlc::policy;
+
+namespace
+{
+enum class Code
+{
+    Unknown = 0,
+    ErrDisk = 1,
+    ErrNet = 2,
+    NetDnsTimeout = 3,
+    NetTcpTimeout = 4,
+    NetTcpReset = 5,
+    Ok = 6
+};
+
+constexpr std::array<trlc::Enum<Code>, 6> kCodes = {{{Code::ErrDisk, "ErrDisk"},
+                                                     {Code::ErrNet, "ErrNet"},
+                                                     {Code::NetDnsTimeout, "NET_DNS_TIMEOUT"},
+                                                     {Code::NetTcpTimeout, "NET_TCP_TIMEOUT"},
+                                                     {Code::NetTcpReset, "NET_TCP_RESET"},
+                                                     {Code::Ok, "Ok"}}};
+constexpr trlc::EnumHolder<Code, kCodes.size(), Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> kHolder{kCodes};
+} // namespace
+
+TEST(EnumSetTest, SetOperations)
+{
+    trlc::EnumSet<70> set;
+    EXPECT_TRUE(set.none());
+    set.set(0);
+    set.set(69);
+    set.set(70);
+    EXPECT_EQ(set.count(), 2u);
+    EXPECT_TRUE(set.test(69));
+    EXPECT_FALSE(set.test(70));
+
+    const auto complement{~set};
+    EXPECT_EQ(complement.count(), 68u);
+    EXPECT_TRUE((set | complement) == ~trlc::EnumSet<70>{});
+    EXPECT_TRUE((set & complement).none());
+    set.reset(0);
+    EXPECT_FALSE(set.test(0));
+    EXPECT_TRUE(set != complement);
+}
+
+TEST(EnumSetTest, IndexFromValueAndString)
+{
+    static_assert(kHolder.size() == 6);
+    static_assert(kHolder.indexFromString("NET_TCP_RESET") == 4);
+    EXPECT_EQ(kHolder.indexFromValue(Code::Ok), 5u);
+    EXPECT_EQ(kHolder.indexFromValue(Code::Unknown), 6u);
+    EXPECT_EQ(kHolder.indexFromString("ErrNet"), 1u);
+    EXPECT_EQ(kHolder.indexFromString("Missing"), 6u);
+
+    // Policies without `find` locate the search result in the entries.
+    static constexpr trlc::EnumHolder<Code, kCodes.size(), Policy::LinearSearchPolicy, Policy::UnicodeCaseInsensitiveStringSearchPolicy, Policy::UnknownPolicy> folded{kCodes};
+    EXPECT_EQ(folded.indexFromString("net_dns_timeout"), 2u);
+    EXPECT_EQ(folded.indexFromString("net_dns"), 6u);
+}
+
+TEST(EnumSetTest, SelectGlob)
+{
+    static constexpr auto errors{trlc::selectGlob(kHolder, "Err*")};
+    static_assert(errors.count() == 2);
+
+    EXPECT_TRUE(errors.test(kHolder.indexFromValue(Code::ErrDisk)));
+    EXPECT_FALSE(errors.test(kHolder.indexFromValue(Code::Ok)));
+    EXPECT_FALSE(errors.test(kHolder.indexFromValue(Code::Unknown)));
+
+    EXPECT_EQ(trlc::selectGlob(kHolder, "NET_*_TIMEOUT").count(), 2u);
+    EXPECT_EQ(trlc::selectGlob(kHolder, "NET_[A-D]??_*").count(), 1u);
+    EXPECT_EQ(trlc::selectGlob(kHolder, "NET_[!D]*").count(), 2u);
+    EXPECT_EQ(trlc::selectGlob(kHolder, "?k").count(), 1u);
+    EXPECT_EQ(trlc::selectGlob(kHolder, "*").count(), 6u);
+    EXPECT_EQ(trlc::selectGlob(kHolder, "Err").count(), 0u);
+    EXPECT_EQ(trlc::selectGlob(kHolder, "**Net").count(), 1u);
+    EXPECT_TRUE(trlc::detail::globMatch(std::string_view{"a\\*[b"}, std::string_view{"a*[b"}));
+    EXPECT_FALSE(trlc::detail::globMatch(std::string_view{"a\\*"}, std::string_view{"ab"}));
+}
+
+TEST(EnumSetTest, SelectRegex)
+{
+    const auto timeouts{trlc::selectRegex(kHolder, "^NET_.*_TIMEOUT$")};
+    ASSERT_TRUE(timeouts.has_value());
+    EXPECT_EQ(timeouts->count(), 2u);
+    EXPECT_TRUE(timeouts->test(kHolder.indexFromString("NET_DNS_TIMEOUT")));
+    EXPECT_FALSE(timeouts->test(kHolder.indexFromString("NET_TCP_RESET")));
+
+    const auto tcp{trlc::selectRegex(kHolder, "tcp", std::regex_constants::ECMAScript | std::regex_constants::icase)};
+    ASSERT_TRUE(tcp.has_value());
+    EXPECT_EQ(tcp->count(), 2u);
+    EXPECT_FALSE(trlc::selectRegex(kHolder, "NET_(").has_value());
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -67,6 +67,101 @@ TEST(EnumHolderTest, CaseInsensitiveSearchTest)
     EXPECT_EQ(holder.fromString("YELLOW").value, Color::Unknown); // Testing unknown string
 }
 
+TEST(EnumHolderTest, WideCharacterNamesTest)
+{
+    static constexpr std::array<trlc::Enum<Color, char16_t>, 3> utf16Entries = {{{Color::Red, u"Red"}, {Color::Green, u"Green"}, {Color::Blue, u"Blue"}}};
+    static constexpr std::array<trlc::Enum<Color, wchar_t>, 3> wideEntries = {{{Color::Red, L"Red"}, {Color::Green, L"Green"}, {Color::Blue, L"Blue"}}};
+
+    trlc::EnumHolder<Color, utf16Entries.size(), Policy::SortedSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy, char16_t> utf16Holder{utf16Entries};
+    trlc::EnumHolder<Color, wideEntries.size(), Policy::LinearSearchPolicy, Policy::CaseInsensitiveStringSearchPolicy, Policy::UnknownPolicy, wchar_t> wideHolder{wideEntries};
+
+    EXPECT_EQ(utf16Holder.fromString(u"Green").value, Color::Green);
+    EXPECT_EQ(utf16Holder.fromString(u"green").value, Color::Unknown);
+    EXPECT_TRUE(utf16Holder.fromValue(Color::Blue).name == u"Blue");
+    EXPECT_EQ(wideHolder.fromString(L"gREEN").value, Color::Green);
+    EXPECT_TRUE(wideHolder.fromValue(Color::Red).name == L"Red");
+    EXPECT_EQ(wideHolder.fromValue(Color::Unknown).value, Color::Unknown);
+}
+
+TEST(EnumHolderTest, SortedSearchOutOfRangeTest)
+{
+    static constexpr std::array<trlc::Enum<int>, 3> sortedEntries = {{{10, "Ten"}, {20, "Twenty"}, {30, "Thirty"}}};
+    trlc::EnumHolder<int, sortedEntries.size(), Policy::SortedSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> holder{sortedEntries};
+
+    EXPECT_EQ(holder.fromValue(20).name, "Twenty");
+    EXPECT_EQ(holder.fromValue(5).name, "");
+    EXPECT_EQ(holder.fromValue(15).name, "");
+    EXPECT_EQ(holder.fromValue(35).name, "");
+}
+
+TEST(EnumHolderTest, NarrowSignedValuesTest)
+{
+    // Runtime lookups go through the type-erased core, constant evaluation through the templated loop.
+    static constexpr std::array<trlc::Enum<int8_t>, 4> entries = {{{-128, "Min"}, {-1, "MinusOne"}, {0, "Zero"}, {127, "Max"}}};
+    static constexpr trlc::EnumHolder<int8_t, entries.size(), Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> linear{entries};
+    static constexpr trlc::EnumHolder<int8_t, entries.size(), Policy::SortedSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> sorted{entries};
+    static_assert(linear.fromValue(-1).name == "MinusOne");
+    static_assert(sorted.fromValue(-128).name == "Min");
+
+    for (const auto& entry : entries)
+    {
+        EXPECT_EQ(linear.fromValue(entry.value).name, entry.name);
+        EXPECT_EQ(sorted.fromValue(entry.value).name, entry.name);
+        EXPECT_EQ(linear.fromString(entry.name).value, entry.value);
+    }
+    EXPECT_EQ(linear.fromValue(5).name, "");
+    EXPECT_EQ(sorted.fromValue(-2).name, "");
+    EXPECT_EQ(linear.fromString("Mi").value, 0);
+    EXPECT_EQ(linear.fromString("").value, 0);
+}
+
+namespace
+{
+constexpr auto uniformIds = []() {
+    std::array<trlc::Enum<int64_t>, 512> entries{};
+    for (size_t index{0}; index < entries.size(); ++index)
+    {
+        entries[index] = {static_cast<int64_t>(index) * 1000 - 200000 + static_cast<int64_t>(index % 7), "Id"};
+    }
+    return entries;
+}();
+
+constexpr auto skewedIds = []() {
+    std::array<trlc::Enum<uint64_t>, 48> entries{};
+    for (size_t index{0}; index < entries.size(); ++index)
+    {
+        entries[index] = {uint64_t{1} << index, "Flag"};
+    }
+    return entries;
+}();
+} // namespace
+
+TEST(EnumHolderTest, InterpolationSearchTest)
+{
+    static_assert(Policy::InterpolationSearchPolicy::isUniform(uniformIds), "evenly spaced values are uniform");
+    static_assert(!Policy::InterpolationSearchPolicy::isUniform(skewedIds), "powers of two are not uniform");
+
+    constexpr trlc::EnumHolder<int64_t, uniformIds.size(), Policy::InterpolationSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> uniformHolder{uniformIds};
+    constexpr trlc::EnumHolder<uint64_t, skewedIds.size(), Policy::InterpolationSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> skewedHolder{skewedIds};
+    static_assert(uniformHolder.fromValue(-200000).name == "Id", "interpolation works at compile time");
+
+    for (const auto& entry : uniformIds)
+    {
+        EXPECT_EQ(uniformHolder.fromValue(entry.value).value, entry.value);
+        EXPECT_EQ(uniformHolder.fromValue(entry.value + 1).name, "");
+        EXPECT_EQ((Policy::InterpolationSearchPolicy::search<int64_t, uniformIds.size()>(entry.value, uniformIds).value), entry.value);
+    }
+    for (const auto& entry : skewedIds)
+    {
+        EXPECT_EQ(skewedHolder.fromValue(entry.value).value, entry.value);
+        EXPECT_EQ((Policy::InterpolationSearchPolicy::search<uint64_t, skewedIds.size()>(entry.value, skewedIds).value), entry.value);
+    }
+    EXPECT_EQ(uniformHolder.fromValue(-300000).name, "");
+    EXPECT_EQ(uniformHolder.fromValue(900000).name, "");
+    EXPECT_EQ(skewedHolder.fromValue(3).name, "");
+    EXPECT_EQ(skewedHolder.fromValue(0).name, "");
+}
+
 TEST(EnumTest, ValueConversion)
 {
     trlc::Enum<int> intEnum{42, "TestInt"};
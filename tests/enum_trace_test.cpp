@@ -0,0 +1,135 @@
+#define TRLC_ENUM_TRACE
+#include "common/enum.hpp"
+
+#include <array>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace Policy = trlc::policy;
+
+namespace
+{
+constexpr std::array<trlc::Enum<int>, 3> kEntries = {{{1, "One"}, {2, "Two"}, {3, "Three"}}};
+constexpr trlc::EnumHolder<int, kEntries.size(), Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> kHolder{kEntries};
+
+size_t countOf(const std::string& text, const std::string& pattern)
+{
+    size_t count{0};
+    for (size_t position{text.find(pattern)}; position != std::string::npos; position = text.find(pattern, position + 1))
+    {
+        ++count;
+    }
+    return count;
+}
+
+std::string exportTrace(size_t& events)
+{
+    std::ostringstream out;
+    events = trlc::writeEnumTrace(out);
+    return out.str();
+}
+} // namespace
+
+// Constant evaluation is unaffected by tracing.
+static_assert(kHolder.fromString("Two").value == 2);
+
+TEST(EnumTraceTest, RecordsLookupsAsChromeTrace)
+{
+    size_t before{0};
+    exportTrace(before);
+
+    EXPECT_EQ(kHolder.fromValue(2).name, "Two");
+    EXPECT_EQ(kHolder.fromString("Four").value, 0);
+    std::thread{[]() { EXPECT_EQ(kHolder.fromString("Three").value, 3); }}.join();
+
+    size_t events{0};
+    const std::string trace{exportTrace(events)};
+    EXPECT_EQ(events, before + 3);
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_EQ(trace.substr(trace.size() - 2), "]}");
+    EXPECT_EQ(countOf(trace, "\"ph\":\"X\""), events);
+    EXPECT_GE(countOf(trace, "\"name\":\"fromValue\""), 1u);
+    EXPECT_GE(countOf(trace, "\"name\":\"fromString\""), 2u);
+    EXPECT_NE(trace.find("\"policy\":\"trlc::policy::LinearSearchPolicy\""), std::string::npos);
+    EXPECT_NE(trace.find("\"policy\":\"trlc::policy::CaseSensitiveStringSearchPolicy\",\"found\":false"), std::string::npos);
+    EXPECT_NE(trace.find("\"key\":2}"), std::string::npos);
+    EXPECT_NE(trace.find("\"tid\":1"), std::string::npos);
+}
+
+TEST(EnumTraceTest, RingKeepsLatestRecords)
+{
+    std::thread{[]() {
+        for (size_t index{0}; index < 3 * trlc::detail::TraceRing::kCapacity; ++index)
+        {
+            kHolder.fromValue(static_cast<int>(index % 4));
+        }
+    }}.join();
+
+    size_t events{0};
+    exportTrace(events);
+    // Every earlier ring holds a handful of lookups; the new thread wrapped around the one it took, whose
+    // oldest slot the export leaves out as the next one to be overwritten.
+    EXPECT_GE(events, trlc::detail::TraceRing::kCapacity - 1);
+    EXPECT_LT(events, trlc::detail::TraceRing::kCapacity + 16);
+}
+
+TEST(EnumTraceTest, ReusesRingsOfExitedThreads)
+{
+    std::thread{[]() { kHolder.fromValue(1); }}.join();
+    const size_t rings{trlc::detail::traceRegistry().rings.size()};
+
+    for (int index{0}; index < 100; ++index)
+    {
+        std::thread{[]() { kHolder.fromValue(1); }}.join();
+    }
+    EXPECT_EQ(trlc::detail::traceRegistry().rings.size(), rings);
+
+    // Threads alive at the same time each get a ring of their own.
+    std::thread first{[]() { kHolder.fromValue(2); }};
+    std::thread second{[]() { kHolder.fromValue(3); }};
+    first.join();
+    second.join();
+    EXPECT_LE(trlc::detail::traceRegistry().rings.size(), rings + 1);
+
+    size_t events{0};
+    const std::string trace{exportTrace(events)};
+    EXPECT_NE(trace.find("\"key\":3}"), std::string::npos);
+}
+
+TEST(EnumTraceTest, KeepsPrecisionOfLateRecords)
+{
+    // Wait until the trace is more than a second old, when six significant digits no longer cover microseconds.
+    const trlc::detail::TraceRegistry& registry{trlc::detail::traceRegistry()};
+    while (trlc::detail::traceNanos() - registry.originNanos < 1100000000)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    kHolder.fromValue(12345);
+
+    std::ostringstream out;
+    out << std::hex << std::setprecision(2);
+    trlc::writeEnumTrace(out);
+    const std::string trace{out.str()};
+    const size_t key{trace.find("\"key\":12345}")};
+    ASSERT_NE(key, std::string::npos);
+    const size_t ts{trace.rfind("\"ts\":", key) + 5};
+    const std::string start{trace.substr(ts, trace.find(',', ts) - ts)};
+    EXPECT_EQ(start.find_first_not_of("0123456789."), std::string::npos) << start;
+    ASSERT_GE(start.size(), 4u);
+    EXPECT_EQ(start[start.size() - 4], '.') << start;
+    EXPECT_GE(std::stod(start), 1.1e6);
+
+    // The caller's stream formatting is restored.
+    EXPECT_TRUE(out.flags() & std::ios_base::hex);
+    EXPECT_EQ(out.precision(), 2);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,123 @@
+#include "common/enum.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string_view>
+
+namespace
+{
+enum class City
+{
+    Unknown = 0,
+    Paris = 1,
+    Zurich = 2,
+    Athens = 3,
+    Moscow = 4
+};
+
+constexpr std::array<trlc::Enum<City>, 5> cityEntries = {{{City::Unknown, "Unknown"},
+                                                         {City::Paris, "Paris"},
+                                                         {City::Zurich, "Zürich"},
+                                                         {City::Athens, "ΑΘΗΝΑ"},
+                                                         {City::Moscow, "Москва"}}};
+
+namespace Policy = trlc::policy;
+using CityHolder = trlc::EnumHolder<City, cityEntries.size(), Policy::LinearSearchPolicy, Policy::UnicodeCaseInsensitiveStringSearchPolicy, Policy::UnknownPolicy>;
+
+constexpr CityHolder cityHolder{cityEntries};
+} // namespace
+
+TEST(UnicodeCaseInsensitiveSearchTest, AsciiNames)
+{
+    EXPECT_EQ(cityHolder.fromString("paris").value, City::Paris);
+    EXPECT_EQ(cityHolder.fromString("PARIS").value, City::Paris);
+    EXPECT_EQ(cityHolder.fromString("unknown").value, City::Unknown);
+    EXPECT_EQ(cityHolder.fromString("Pari").value, City::Unknown);
+    EXPECT_EQ(cityHolder.fromString("a much longer ascii query that crosses sixteen bytes").value, City::Unknown);
+}
+
+TEST(UnicodeCaseInsensitiveSearchTest, NonAsciiNames)
+{
+    EXPECT_EQ(cityHolder.fromString("ZÜRICH").value, City::Zurich);
+    EXPECT_EQ(cityHolder.fromString("zürich").value, City::Zurich);
+    EXPECT_EQ(cityHolder.fromString("αθηνα").value, City::Athens);
+    EXPECT_EQ(cityHolder.fromString("МОСКВА").value, City::Moscow);
+    EXPECT_EQ(cityHolder.fromString("москва").value, City::Moscow);
+    EXPECT_EQ(cityHolder.fromString("zurich").value, City::Unknown);
+    EXPECT_EQ(cityHolder.fromString("\xFF\xFE").value, City::Unknown);
+}
+
+TEST(UnicodeCaseInsensitiveSearchTest, IrregularPairs)
+{
+    using trlc::detail::foldCodePoint;
+    static_assert(foldCodePoint(0x4C0) == 0x4CF, "palochka");
+    static_assert(foldCodePoint(0x4C1) == 0x4C2 && foldCodePoint(0x4CD) == 0x4CE && foldCodePoint(0x4C2) == 0x4C2, "odd-based Cyrillic pairs");
+    static_assert(foldCodePoint(0x4D0) == 0x4D1 && foldCodePoint(0x4BF) == 0x4BF, "neighbouring even-based pairs are unchanged");
+    static_assert(foldCodePoint(0x1E9E) == 0xDF && foldCodePoint(0x1E9B) == 0x1E61, "capital sharp s, long s with dot above");
+    static_assert(foldCodePoint(0x3D0) == 0x3B2 && foldCodePoint(0x3D1) == 0x3B8 && foldCodePoint(0x3D5) == 0x3C6 && foldCodePoint(0x3D6) == 0x3C0 && foldCodePoint(0x3F0) == 0x3BA &&
+                      foldCodePoint(0x3F1) == 0x3C1 && foldCodePoint(0x3F5) == 0x3B5 && foldCodePoint(0x3F4) == 0x3B8,
+                  "Greek symbol variants");
+    static_assert(foldCodePoint(0x3D8) == 0x3D9 && foldCodePoint(0x3EE) == 0x3EF && foldCodePoint(0x3EF) == 0x3EF, "archaic and Coptic pairs");
+    static_assert(foldCodePoint(0x370) == 0x371 && foldCodePoint(0x372) == 0x373 && foldCodePoint(0x376) == 0x377 && foldCodePoint(0x371) == 0x371, "heta, sampi, digamma");
+    static_assert(foldCodePoint(0x37F) == 0x3F3 && foldCodePoint(0x3CF) == 0x3D7 && foldCodePoint(0x3F7) == 0x3F8 && foldCodePoint(0x3F9) == 0x3F2 && foldCodePoint(0x3FA) == 0x3FB,
+                  "yot, kai, sho, lunate sigma, san");
+    static_assert(foldCodePoint(0x3FD) == 0x37B && foldCodePoint(0x3FF) == 0x37D && foldCodePoint(0x3FB) == 0x3FB, "reversed lunate sigmas");
+
+    static constexpr std::array<trlc::Enum<City>, 3> entries = {{{City::Paris, "ӁӀ"}, {City::Zurich, "STRAẞE"}, {City::Athens, "ϴϐϕϖϰϱϵ"}}};
+    constexpr trlc::EnumHolder<City, entries.size(), Policy::LinearSearchPolicy, Policy::UnicodeCaseInsensitiveStringSearchPolicy, Policy::UnknownPolicy> holder{entries};
+    EXPECT_EQ(holder.fromString("ӂӏ").value, City::Paris);
+    EXPECT_EQ(holder.fromString("straße").value, City::Zurich);
+    EXPECT_EQ(holder.fromString("θβφπκρε").value, City::Athens);
+}
+
+TEST(UnicodeCaseInsensitiveSearchTest, ConstexprLookup)
+{
+    using UnicodePolicy = Policy::UnicodeCaseInsensitiveStringSearchPolicy;
+    static_assert(cityHolder.fromString("zÜrIcH").value == City::Zurich, "folded keys are usable at compile time");
+    static_assert(UnicodePolicy::search<City, cityEntries.size()>("ΑΘΗΝΑ", cityEntries).value == City::Athens, "unindexed search is usable at compile time");
+    EXPECT_EQ((UnicodePolicy::search<City, cityEntries.size()>("moSCOW", cityEntries).value), City::Unknown);
+}
+
+TEST(UnicodeCaseInsensitiveSearchTest, AsciiDetection)
+{
+    using namespace std::literals;
+    EXPECT_TRUE(trlc::detail::isAscii("plain ascii text spanning more than one vector"sv));
+    EXPECT_FALSE(trlc::detail::isAscii("plain ascii text spanning more than one vector ü"sv));
+    EXPECT_FALSE(trlc::detail::isAscii("ü plain ascii text spanning more than one vector"sv));
+    EXPECT_TRUE(trlc::detail::isAscii(""sv));
+    EXPECT_TRUE(trlc::detail::isAscii(u"plain ascii text spanning more than one vector"sv));
+    EXPECT_FALSE(trlc::detail::isAscii(u"plain ascii text spanning more than one vector ü"sv));
+    EXPECT_FALSE(trlc::detail::isAscii(U"ascii text ü ascii text"sv));
+}
+
+TEST(UnicodeCaseInsensitiveSearchTest, Utf16Names)
+{
+    static constexpr std::array<trlc::Enum<City, char16_t>, 3> entries = {{{City::Zurich, u"Zürich"},
+                                                                          {City::Athens, u"ΑΘΗΝΑ"},
+                                                                          {City::Moscow, u"Москва"}}};
+    constexpr trlc::EnumHolder<City, entries.size(), Policy::LinearSearchPolicy, Policy::UnicodeCaseInsensitiveStringSearchPolicy, Policy::UnknownPolicy, char16_t> holder{entries};
+
+    EXPECT_EQ(holder.fromString(u"ZÜRICH").value, City::Zurich);
+    EXPECT_EQ(holder.fromString(u"αθηνα").value, City::Athens);
+    EXPECT_EQ(holder.fromString(u"МОСКВА").value, City::Moscow);
+    EXPECT_EQ(holder.fromString(u"Paris").value, City::Unknown);
+    EXPECT_TRUE(holder.fromString(u"Paris").name.empty());
+}
+
+#if defined(__cpp_char8_t)
+TEST(UnicodeCaseInsensitiveSearchTest, Utf8CharNames)
+{
+    static constexpr std::array<trlc::Enum<City, char8_t>, 2> entries = {{{City::Zurich, u8"Zürich"}, {City::Moscow, u8"Москва"}}};
+    constexpr trlc::EnumHolder<City, entries.size(), Policy::LinearSearchPolicy, Policy::UnicodeCaseInsensitiveStringSearchPolicy, Policy::UnknownPolicy, char8_t> holder{entries};
+
+    EXPECT_EQ(holder.fromString(u8"zÜRICH").value, City::Zurich);
+    EXPECT_EQ(holder.fromString(u8"москва").value, City::Moscow);
+    EXPECT_EQ(holder.fromString(u8"Paris").value, City::Unknown);
+}
+#endif
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,104 @@
+#include "common/enum.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+
+namespace Policy = trlc::policy;
+
+namespace
+{
+template<size_t K>
+using Bytes = std::array<std::byte, K>;
+
+template<size_t K>
+constexpr Bytes<K> makeBytes(uint64_t seed)
+{
+    Bytes<K> bytes{};
+    for (size_t index{0}; index < K; ++index)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        bytes[index] = static_cast<std::byte>(seed >> 56);
+    }
+    return bytes;
+}
+
+template<size_t K, size_t N>
+constexpr std::array<trlc::Enum<Bytes<K>>, N> makeEntries()
+{
+    std::array<trlc::Enum<Bytes<K>>, N> entries{};
+    for (size_t index{0}; index < N; ++index)
+    {
+        entries[index].value = makeBytes<K>(index + 1);
+        entries[index].name = "Code";
+    }
+    return entries;
+}
+
+template<size_t K, size_t N>
+void checkByteKeys()
+{
+    static constexpr auto kEntries{makeEntries<K, N>()};
+    constexpr trlc::EnumHolder<Bytes<K>, N, Policy::WideKeySearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> holder{kEntries};
+    static_assert(holder.indexFromValue(makeBytes<K>(3)) == 2, "the wide key index is usable at compile time");
+
+    for (size_t index{0}; index < N; ++index)
+    {
+        EXPECT_EQ(holder.indexFromValue(kEntries[index].value), index);
+        EXPECT_TRUE(holder.fromValue(kEntries[index].value).value == kEntries[index].value);
+    }
+    auto missing{kEntries[0].value};
+    missing[K - 1] ^= std::byte{1};
+    EXPECT_EQ(holder.indexFromValue(missing), N);
+    EXPECT_EQ(holder.indexFromValue(Bytes<K>{}), N);
+}
+} // namespace
+
+#if defined(__SIZEOF_INT128__)
+TEST(WideKeySearchTest, Uint128Values)
+{
+    using Uuid = trlc::Uint128;
+    constexpr Uuid kHigh{static_cast<Uuid>(0x123e4567e89b12d3ULL) << 64};
+    static constexpr std::array<trlc::Enum<Uuid>, 4> kDevices = {{{kHigh | 0xa456426614174000ULL, "Sensor"},
+                                                                 {kHigh | 0xa456426614174001ULL, "Actuator"},
+                                                                 {static_cast<Uuid>(1) << 127, "Gateway"},
+                                                                 {kHigh | 0xa456426614174000ULL, "Duplicate"}}};
+    constexpr trlc::EnumHolder<Uuid, kDevices.size(), Policy::WideKeySearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> holder{kDevices};
+    static_assert(holder.fromValue(static_cast<Uuid>(1) << 127).name == "Gateway");
+
+    EXPECT_EQ(holder.fromValue(kHigh | 0xa456426614174000ULL).name, "Sensor"); // first definition wins
+    EXPECT_EQ(holder.fromValue(kHigh | 0xa456426614174001ULL).name, "Actuator");
+    EXPECT_EQ(holder.fromValue(0xa456426614174001ULL).name, "");
+    EXPECT_EQ(holder.fromValue(kHigh).name, "");
+    EXPECT_TRUE(holder.fromString("Gateway").value == static_cast<Uuid>(1) << 127);
+}
+#endif
+
+TEST(WideKeySearchTest, ByteArrayValues)
+{
+    checkByteKeys<16, 40>();
+    checkByteKeys<32, 40>();
+    checkByteKeys<20, 7>();
+}
+
+TEST(WideKeySearchTest, MatchesLinearSearch)
+{
+    static constexpr auto kEntries{makeEntries<32, 100>()};
+    constexpr trlc::EnumHolder<Bytes<32>, 100, Policy::WideKeySearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> hashed{kEntries};
+    const trlc::EnumHolder<Bytes<32>, 100, Policy::LinearSearchPolicy, Policy::CaseSensitiveStringSearchPolicy, Policy::UnknownPolicy> linear{kEntries};
+
+    std::mt19937 random{3};
+    for (int round{0}; round < 1000; ++round)
+    {
+        const auto key{makeBytes<32>(random() % 150)};
+        EXPECT_EQ(hashed.indexFromValue(key), linear.indexFromValue(key));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}